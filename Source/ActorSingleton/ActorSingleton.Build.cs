@@ -13,15 +13,8 @@ public class ActorSingleton : ModuleRules
 			"Core",
 			"CoreUObject",
 			"Engine",
+			"DeveloperSettings",
+			"TraceLog",
 		});
-
-		// we only want this to be included for editor builds but not packaged builds
-		if (Target.bBuildEditor)
-		{
-			PublicDependencyModuleNames.AddRange(new string[]
-			{
-				"UnrealEd",
-			});
-		}
 	}
 }
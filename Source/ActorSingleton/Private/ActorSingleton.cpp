@@ -1,37 +1,83 @@
 // Published under MIT License, created by https://github.com/sleeptightAnsiC
 
 #include "ActorSingleton.h"
-#include "Kismet/GameplayStatics.h"
+#include "ActorSingletonSettings.h"
+#include "ActorSingletonTrace.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
 #include "Logging/StructuredLog.h"
-#include "Misc/MessageDialog.h"
+#include "Misc/CoreDelegates.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectGlobals.h"
 
+IMPLEMENT_MODULE(FActorSingletonModule, ActorSingleton)
+
+DEFINE_LOG_CATEGORY(ActorSingleton);
+
+#if ACTORSINGLETON_WITH_LOGGING
+static TAutoConsoleVariable<float> CVarLogAggregationWindow(
+	TEXT("ActorSingleton.LogAggregationWindow"),
+	1.f,
+	TEXT("Time (in seconds) during which repeated ActorSingleton messages about the same class and World are aggregated.\n")
+	TEXT("Only the first one is logged in full, the rest is reported as a single summary.\n")
+	TEXT("0 or less logs every single message."),
+	ECVF_Default);
+#endif //ACTORSINGLETON_WITH_LOGGING
+
+TMap<TObjectKey<UClass>, TSubclassOf<AActorSingleton>> AActorSingleton::FinalParentCache;
+uint32 AActorSingleton::FinalParentCacheSerial = 1;
+TMap<TObjectKey<UClass>, int32> AActorSingleton::SlotIndices;
+TMap<TObjectKey<ULevel>, TArray<TWeakObjectPtr<AActorSingleton>>> UActorSingletonManager::PendingInstances;
+uint32 UActorSingletonManager::RegistryGeneration = 1;
+const UWorld* UActorSingletonManager::CachedWorld = nullptr;
+UActorSingletonManager* UActorSingletonManager::CachedManager = nullptr;
 #if WITH_EDITOR
-#include "Subsystems/EditorActorSubsystem.h"
-#include "Editor.h"
+TDelegate<void(AActorSingleton*)> FActorSingletonEditorHooks::OnEditorDuplicateFound;
 #endif //WITH_EDITOR
 
-IMPLEMENT_MODULE(FActorSingletonModule, ActorSingleton)
 
-DEFINE_LOG_CATEGORY(ActorSingleton);
+/* virtual override */ void FActorSingletonModule::StartupModule()
+{
+	/* Hot Reload and Live Coding may replace IsFinalParent_Implementation of any native class */
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda(
+		[](EReloadCompleteReason)->void
+		{
+			AActorSingleton::InvalidateFinalParentCache();
+		}
+	);
+}
+
+
+/* virtual override */ void FActorSingletonModule::ShutdownModule()
+{
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	AActorSingleton::InvalidateFinalParentCache();
+}
+
+
+#if WITH_EDITOR
+/* static */ void FActorSingletonEditorHooks::InvalidateFinalParentCache()
+{
+	AActorSingleton::InvalidateFinalParentCache();
+}
+#endif //WITH_EDITOR
 
 
 void AActorSingleton::TryBecomeNewInstanceOrSelfDestroy()
 {
-	/* Do nothing, if 'this' is either...
-	*	...not valid (such case has never happened but always worth cathing)
-	*	...being destroyed (IsValid does NOT catch this in some cases)
-	*	...marked as Transient (we omit "dummy" Actors that are often being used by the Editor) */
-	if(
-		!ensure(IsValid(this))
-		|| this->IsActorBeingDestroyed()
-		|| this->HasAnyFlags(EObjectFlags::RF_Transient)
-		)
+	/* Construction script reruns on every edit in the Editor (every frame while dragging the Actor around),
+	*	and there is nothing to resolve if 'this' already is the registered instance.
+	* RegisteredSlot is cleared on every eviction, so checking it is enough, and it's done before anything else (even stats). */
+	if (RegisteredSlot != INDEX_NONE)
 	{
 		return;
 	}
 
-	/* Do nothing, if 'this' is CDO */
-	if (this == GetClass()->GetDefaultObject())
+	ACTORSINGLETON_TRACE_SCOPE(AActorSingleton::TryBecomeNewInstanceOrSelfDestroy);
+	SCOPE_CYCLE_COUNTER(STAT_ActorSingleton_DuplicateResolution);
+	CSV_SCOPED_TIMING_STAT(ActorSingleton, DuplicateResolution);
+
+	if (!CanBecomeInstance())
 	{
 		return;
 	}
@@ -43,10 +89,10 @@ void AActorSingleton::TryBecomeNewInstanceOrSelfDestroy()
 	/* UActorSingletonManager::Get can fail (and this is expected)
 	* There are cases where UActorSingletonManager might not be Initialized yet,
 	*	e.g. during AActor::OnConstruction when opening Map in the Editor.
-	* We deal with said problem by re-firing this function later in the UActorSingletonManager::PostInitialize
-	* This is not an ideal solution but works fine for now, see UActorSingletonManager::PostInitialize */
+	* We deal with said problem by queuing 'this' and re-firing this function later in the UActorSingletonManager::PostInitialize */
 	if(!ActorSingletonManager)
 	{
+		UActorSingletonManager::AddPendingInstance(this);
 		return;
 	}
 
@@ -57,12 +103,8 @@ void AActorSingleton::TryBecomeNewInstanceOrSelfDestroy()
 		return;
 	}
 
-	TMap<TSubclassOf<AActorSingleton>, AActorSingleton*>& InstancesMap = ActorSingletonManager->Instances;
-	if (!InstancesMap.Contains(ParentClass))
-	{
-		InstancesMap.Add(ParentClass, nullptr);
-	}
-	AActorSingleton*& CurrentInstance = InstancesMap[ParentClass];
+	const int32 Slot = GetSlotIndex(ParentClass);
+	AActorSingleton* const CurrentInstance = ActorSingletonManager->GetInstanceAtSlot(Slot);
 
 	if (this == CurrentInstance)
 	{
@@ -74,69 +116,32 @@ void AActorSingleton::TryBecomeNewInstanceOrSelfDestroy()
 	* In this case, start treating 'this' as new singleton instance. */
 	if (!IsValid(CurrentInstance))
 	{
-		CurrentInstance = this;
+		ActorSingletonManager->RegisterInstance(this, Slot);
 
-		UE_LOGFMT(ActorSingleton, Warning,
-			"'{ActorName}' is now a Singleton instance of class '{ClassName}' in the World '{WorldName}'! "
-			"Adding/Spawning more instances of the same class in the same World will resul in them being destroyed!",
-			AActor::GetDebugName(this), ParentClass->GetFName(), ThisWorld->GetFName());
+#if ACTORSINGLETON_WITH_LOGGING
+		if (ActorSingletonManager->ShouldLogInFull(EActorSingletonLogKind::NewInstance, ParentClass))
+		{
+			UE_LOGFMT(ActorSingleton, Warning,
+				"'{ActorName}' is now a Singleton instance of class '{ClassName}' in the World '{WorldName}'! "
+				"Adding/Spawning more instances of the same class in the same World will resul in them being destroyed!",
+				AActor::GetDebugName(this), ParentClass->GetFName(), ThisWorld->GetFName());
+		}
+#endif //ACTORSINGLETON_WITH_LOGGING
 
 		return;
 	}
 
 	/* At this point we know that 'this' is a duplicate and we gonna destroy it so let's log an error about it.
 	* We consider such case as an error, because when it happens, you're doing something wrong. */
-	UE_LOGFMT(ActorSingleton, Error,
-		"World '{WorldName}' can have only one instance of '{ClassName}'! Destroying '{ActorName}' ...",
-		ThisWorld->GetFName(), ParentClass->GetFName(), AActor::GetDebugName(this));
+	LogDestroyingDuplicate(ParentClass);
 
 #if WITH_EDITOR
 	/* In case of placing an Actor in the Level Viewport, we canNOT simply Destroy it.
-	* Instead, we must "tell" the Editor to delete it, which will fire some additional clean up logic.
-	* Also we're showing a message to the Editor user telling what is happening, so we can avoid confusion.
-	*
-	* FIXME: Current implementation is fine but has few caveats:
-	* 1. it "touches" the Level despite that no actual changes have been done
-	* 2. if user uses 'undo' after deletion, the duplicate object will be restored
-	* 3. if user's Actor does something after being placed, we won't be able to revert it
-	* These are pretty bad... I should probably find another way to achieve the same goal.
-	*
-	* TODO: Possible solutions for the issues listed above:
-	* 1. Prevent Actor from being placed into the Level in the first place
-	* 	I have no idea if this can be achieved with Unreal Engine...
-	* 	If that's possible, then there is probably some kind of Interface in AActor that allows it
-	* 		but otherwise I have no clue where to look for solution
-	* 2. Instead of deletion, we can simply use Editor's 'undo' feature
-	* 	The problem with this one is that we would never know for sure how many times call the 'undo'
-	* 		because Actor, when placed, can do some other stuff around which adds up to the undo/redo buffer.
-	*	We would need to find out how many times we need to call the 'undo'
-	*	However, this option seems the most promising and possible to implement :)
-	*/
-	if (ThisWorld->IsEditorWorld() && !ThisWorld->IsPlayInEditor())
-	{
-		/* Show Dialogue Message */
-		const FText MessageTitle = this->GetMessageTitle();
-		const FText MessageBody = this->GetMessageBody();
-		FMessageDialog::Debugf(MessageBody, MessageTitle);
-
-		/* Delete 'this' via UEditorActorSubsystem */
-		auto* EditorActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-		check(EditorActorSubsystem)
-		EditorActorSubsystem->ClearActorSelectionSet();
-		EditorActorSubsystem->SetActorSelectionState(this, true);
-		EditorActorSubsystem->DeleteSelectedActors(ThisWorld);
-		GEngine->ForceGarbageCollection(true);
-
-		/* Garbage Actor still seems to be selected in the Details Panel despite already being destroyed.
-		* 'UEditorActorSubsystem::DeleteSelectedActors' doesn't handle this by itself,
-		* so we are clearing the Actor selection on the very next tick which fixes this issue. */
-		ThisWorld->GetTimerManager().SetTimerForNextTick(
-			[&]()->void
-			{
-				EditorActorSubsystem->SelectNothing();
-			}
-		);
-
+	* Instead, we let ActorSingletonEditor module delete it the way the Editor expects,
+	*	and show a message to the Editor user telling what is happening (see FActorSingletonEditorHooks::OnEditorDuplicateFound) */
+	if (ThisWorld->IsEditorWorld() && !ThisWorld->IsPlayInEditor() && FActorSingletonEditorHooks::OnEditorDuplicateFound.IsBound())
+	{
+		FActorSingletonEditorHooks::OnEditorDuplicateFound.Execute(this);
 		return;
 	}
 #endif //WITH_EDITOR
@@ -147,6 +152,56 @@ void AActorSingleton::TryBecomeNewInstanceOrSelfDestroy()
 }
 
 
+void AActorSingleton::LogDestroyingDuplicate(const TSubclassOf<AActorSingleton> ParentClass) const
+{
+	ACTORSINGLETON_TRACE(DuplicateDestroyed, this, ParentClass);
+	FActorSingletonStats::RecordDuplicateRejected();
+
+#if ACTORSINGLETON_WITH_LOGGING
+	UActorSingletonManager* const ActorSingletonManager = UActorSingletonManager::Get(GetWorld());
+	if (!ActorSingletonManager || ActorSingletonManager->ShouldLogInFull(EActorSingletonLogKind::Duplicate, ParentClass))
+	{
+		UE_LOGFMT(ActorSingleton, Error,
+			"World '{WorldName}' can have only one instance of '{ClassName}'! Destroying '{ActorName}' ...",
+			GetWorld()->GetFName(), ParentClass->GetFName(), AActor::GetDebugName(this));
+	}
+#endif //ACTORSINGLETON_WITH_LOGGING
+}
+
+
+bool AActorSingleton::CanBecomeInstance() const
+{
+	/* Ignore 'this', if it is either...
+	*	...not valid (such case has never happened but always worth cathing)
+	*	...being destroyed (IsValid does NOT catch this in some cases)
+	*	...marked as Transient (we omit "dummy" Actors that are often being used by the Editor)
+	*	...CDO */
+	return ensure(IsValid(this))
+		&& !this->IsActorBeingDestroyed()
+		&& !this->HasAnyFlags(EObjectFlags::RF_Transient)
+		&& this != GetClass()->GetDefaultObject();
+}
+
+
+bool AActorSingleton::IsDuplicate()
+{
+	if (!CanBecomeInstance())
+	{
+		return false;
+	}
+
+	const UActorSingletonManager* const ActorSingletonManager = UActorSingletonManager::Get(GetWorld());
+	const TSubclassOf<AActorSingleton> ParentClass = GetFinalParent();
+	if (!ActorSingletonManager || !ParentClass)
+	{
+		return false;
+	}
+
+	const AActorSingleton* const CurrentInstance = ActorSingletonManager->GetInstanceAtSlot(GetSlotIndex(ParentClass));
+	return IsValid(CurrentInstance) && CurrentInstance != this;
+}
+
+
 /* virtual */ FText AActorSingleton::GetMessageTitle_Implementation() const
 {
 	 return FText::FromString("ActorSingleton - Destroyed Duplicate");
@@ -165,6 +220,9 @@ void AActorSingleton::TryBecomeNewInstanceOrSelfDestroy()
 
 /* static */ AActorSingleton* AActorSingleton::GetInstance(const UObject* const  WorldContext, TSubclassOf<AActorSingleton> Class)
 {
+	ACTORSINGLETON_TRACE_SCOPE(AActorSingleton::GetInstance);
+
+#if ACTORSINGLETON_LOOKUP_VALIDATION
 	/* I don't really remember why I placed 'ensure' here but for sure I had a good reason.
 	* Now when I read this code it makes more sense to just crash in this place
 	* 	since you're most likely doing something wrong by passing invalid WorldContext.
@@ -173,30 +231,152 @@ void AActorSingleton::TryBecomeNewInstanceOrSelfDestroy()
 	{
 		return nullptr;
 	}
+#endif //ACTORSINGLETON_LOOKUP_VALIDATION
 
 	const auto* ActorSingletonManager = UActorSingletonManager::Get(WorldContext);
 
 	/* This case can happen but is very rare
 	*		and I don't really understand why this is possible in the first place.
 	* It has happened to me when compiling a Blueprint of an Actor that was placed in the Level Viewport
-	*		or when opening Content Browser with the same Blueprint. */
-	if (!ensure(IsValid(ActorSingletonManager)))
+	*		or when opening Content Browser with the same Blueprint.
+	* It's also expected in the UWorlds excluded by UActorSingletonSettings, those never have any instance. */
+#if ACTORSINGLETON_LOOKUP_VALIDATION
+	if (!IsValid(ActorSingletonManager))
 	{
+		ensure(!UActorSingletonManager::ShouldExistIn(WorldContext));
 		return nullptr;
 	}
+#else
+	if (!ActorSingletonManager)
+	{
+		return nullptr;
+	}
+#endif //ACTORSINGLETON_LOOKUP_VALIDATION
 
-	auto& InstancesMap = ActorSingletonManager->Instances;
 	AActorSingleton* CDO = static_cast<AActorSingleton*>(Class->GetDefaultObject());
 	TSubclassOf<AActorSingleton> ParentClass = CDO->GetFinalParent();
-	if (
-		ensure(ParentClass)
-		&& InstancesMap.Contains(ParentClass)
-		)
+
+	/* Without FinalParent the slot is INDEX_NONE, and UActorSingletonManager::GetInstanceAtSlot returns 'nullptr' for it anyway */
+#if ACTORSINGLETON_LOOKUP_VALIDATION
+	ensure(ParentClass);
+#endif //ACTORSINGLETON_LOOKUP_VALIDATION
+	AActorSingleton* const Instance = ActorSingletonManager->GetInstanceAtSlot(GetSlotIndex(ParentClass));
+
+	FActorSingletonStats::RecordLookup(Instance != nullptr);
+	return Instance;
+}
+
+
+/* static */ AActorSingleton* AActorSingleton::GetInstanceCached(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class, FActorSingletonCachedReference& Cache)
+{
+	const uint32 Generation = UActorSingletonManager::GetRegistryGeneration();
+	if (Cache.Generation == Generation && Cache.FinalParentCacheSerial == FinalParentCacheSerial)
 	{
-		return InstancesMap[ParentClass];
+		return Cache.Instance;
 	}
 
-	return nullptr;
+	/* Owner of the node always lives in the same UWorld, so the Generation is all we need to check */
+	Cache.Instance = GetInstance(WorldContext, Class);
+	Cache.Generation = Generation;
+	Cache.FinalParentCacheSerial = FinalParentCacheSerial;
+	return Cache.Instance;
+}
+
+
+/* static */ void AActorSingleton::BindOnInstanceChanged(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class, FOnActorSingletonInstanceChangedDynamic Event)
+{
+	UActorSingletonManager* const ActorSingletonManager = UActorSingletonManager::Get(WorldContext);
+	if (!IsValid(ActorSingletonManager))
+	{
+		ensure(!UActorSingletonManager::ShouldExistIn(WorldContext));
+		return;
+	}
+
+	if (!ensure(Class) || !ensure(Class->GetDefaultObject<AActorSingleton>()->GetFinalParent()))
+	{
+		return;
+	}
+
+	ActorSingletonManager->FindOrAddInstanceChangedEvents(Class).Dynamic.AddUnique(Event);
+}
+
+
+/* static */ void AActorSingleton::UnbindOnInstanceChanged(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class, FOnActorSingletonInstanceChangedDynamic Event)
+{
+	UActorSingletonManager* const ActorSingletonManager = UActorSingletonManager::Get(WorldContext);
+	if (!IsValid(ActorSingletonManager) || !Class)
+	{
+		return;
+	}
+
+	const int32 Slot = GetSlotIndex(Class->GetDefaultObject<AActorSingleton>()->GetFinalParent());
+	if (const TUniquePtr<FActorSingletonInstanceChangedEvents>* const Events = ActorSingletonManager->InstanceChangedEvents.Find(Slot))
+	{
+		(*Events)->Dynamic.Remove(Event);
+	}
+}
+
+
+/* static */ TFuture<AActorSingleton*> AActorSingleton::WaitForInstance(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class)
+{
+	UActorSingletonManager* const ActorSingletonManager = IsValid(WorldContext) ? UActorSingletonManager::Get(WorldContext) : nullptr;
+	if (!IsValid(ActorSingletonManager))
+	{
+		/* Expected in the UWorlds excluded by UActorSingletonSettings, nothing is ever going to be registered there */
+		ensure(!IsValid(WorldContext) || !UActorSingletonManager::ShouldExistIn(WorldContext));
+		return MakeFulfilledPromise<AActorSingleton*>(nullptr).GetFuture();
+	}
+
+	if (!ensure(Class))
+	{
+		return MakeFulfilledPromise<AActorSingleton*>(nullptr).GetFuture();
+	}
+
+	return ActorSingletonManager->WaitForInstance(Class);
+}
+
+
+/* static */ AActorSingleton* AActorSingleton::TrySpawnSingleton(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class, const FTransform& Transform)
+{
+	return TrySpawnSingletonInternal(WorldContext, Class, Transform, FActorSpawnParameters());
+}
+
+
+/* static */ AActorSingleton* AActorSingleton::TrySpawnSingletonInternal(
+	const UObject* const WorldContext,
+	TSubclassOf<AActorSingleton> Class,
+	const FTransform& Transform,
+	const FActorSpawnParameters& SpawnParameters)
+{
+	if (!ensure(IsValid(WorldContext)) || !ensure(Class))
+	{
+		return nullptr;
+	}
+
+	/* Registry is checked before spawning anything, so there is nothing to construct and destroy later */
+	AActorSingleton* const ExistingInstance = GetInstance(WorldContext, Class);
+	if (IsValid(ExistingInstance))
+	{
+		/* Instance of a sibling class occupies the slot, spawning would only create a duplicate to be destroyed */
+		return ExistingInstance->IsA(Class) ? ExistingInstance : nullptr;
+	}
+
+	UWorld* const World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::Assert);
+	return World->SpawnActor<AActorSingleton>(Class, Transform, SpawnParameters);
+}
+
+
+/* virtual override */ void AActorSingleton::PostActorCreated()
+{
+	Super::PostActorCreated();
+
+	/* Duplicate has been caught already in UActorSingletonManager::HandleActorPreSpawnInitialization,
+	*	so its components haven't been registered, and we destroy it before any construction script runs. */
+	if (bRejectedOnSpawn)
+	{
+		LogDestroyingDuplicate(GetFinalParent());
+		this->Destroy(true, true);
+	}
 }
 
 
@@ -207,12 +387,85 @@ void AActorSingleton::TryBecomeNewInstanceOrSelfDestroy()
 }
 
 
+/* virtual override */ void AActorSingleton::PostLoad()
+{
+	Super::PostLoad();
+
+	/* Actors loaded together with their Level never go through OnConstruction in cooked builds,
+	*	and when they get loaded, UWorld (and so UActorSingletonManager) usually doesn't exist yet.
+	* Instead of letting UActorSingletonManager look for them among every Actor in the UWorld,
+	*	we let them queue themselves, so it only has to go through the Actors that actually matter. */
+	if (!IsTemplate())
+	{
+		UActorSingletonManager::AddPendingInstance(this);
+	}
+}
+
+
+/* virtual override */ void AActorSingleton::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromManager();
+	Super::EndPlay(EndPlayReason);
+}
+
+
+/* virtual override */ void AActorSingleton::Destroyed()
+{
+	/* EndPlay is never called in the Editor World (nothing has begun play there), so we must catch deletion here too */
+	UnregisterFromManager();
+	Super::Destroyed();
+}
+
+
+void AActorSingleton::UnregisterFromManager()
+{
+	if (RegisteredSlot == INDEX_NONE)
+	{
+		return;
+	}
+
+	/* Manager may already be gone, e.g. when the whole UWorld is being torn down */
+	const UWorld* const ThisWorld = GetWorld();
+	if (UActorSingletonManager* const ActorSingletonManager = ThisWorld ? ThisWorld->GetSubsystem<UActorSingletonManager>() : nullptr)
+	{
+		ActorSingletonManager->UnregisterInstance(this);
+	}
+
+	RegisteredSlot = INDEX_NONE;
+}
+
+
 TSubclassOf<AActorSingleton> AActorSingleton::GetFinalParent()
 {
-	TArray<TSubclassOf<AActorSingleton>> InheritanceChain;
+	ACTORSINGLETON_TRACE_SCOPE(AActorSingleton::GetFinalParent);
+
+	if (UClass* const DeclaredRoot = GetDeclaredSingletonRoot())
+	{
+		return DeclaredRoot;
+	}
+
+	UClass* const ThisClass = GetClass();
+	const TObjectKey<UClass> ClassKey(ThisClass);
+
+	if (const TSubclassOf<AActorSingleton>* const CachedFinalParent = FinalParentCache.Find(ClassKey))
+	{
+		return *CachedFinalParent;
+	}
+
+	/* We also cache 'nullptr' (e.g. for Abstract classes), as it is a valid result too */
+	const TSubclassOf<AActorSingleton> FinalParent = ResolveFinalParent(ThisClass);
+	FinalParentCache.Add(ClassKey, FinalParent);
+	return FinalParent;
+}
+
+
+/* static */ TSubclassOf<AActorSingleton> AActorSingleton::ResolveFinalParent(UClass* const Class)
+{
+	/* Inheritance chains are rarely deep, so we can easily avoid heap allocation here */
+	TArray<UClass*, TInlineAllocator<16>> InheritanceChain;
 	/* Go through the UClass::GetSuperClass chain, from current class to 'AActorSingleton',
 	* and store said chain as we gonna traverse it backwards later. */
-	for (TSubclassOf<AActorSingleton> ItClass = GetClass(); ItClass != AActorSingleton::StaticClass(); ItClass = ItClass->GetSuperClass())
+	for (UClass* ItClass = Class; ItClass != AActorSingleton::StaticClass(); ItClass = ItClass->GetSuperClass())
 	{
 		InheritanceChain.Add(ItClass);
 	}
@@ -223,7 +476,9 @@ TSubclassOf<AActorSingleton> AActorSingleton::GetFinalParent()
 	for (int32 i = InheritanceChain.Num() - 1; i >= 0; --i)
 	{
 		UObject* ItCDO = InheritanceChain[i]->GetDefaultObject();
-		const bool bItFinalParent = static_cast<AActorSingleton*>(ItCDO)->IsFinalParent();
+		/* Declared root (see AActorSingleton::bSingletonRoot) is checked first, so it never runs the BlueprintNativeEvent */
+		const bool bItFinalParent = static_cast<AActorSingleton*>(ItCDO)->bSingletonRoot
+			|| static_cast<AActorSingleton*>(ItCDO)->IsFinalParent();
 		if (bItFinalParent)
 		{
 			return InheritanceChain[i];
@@ -234,27 +489,704 @@ TSubclassOf<AActorSingleton> AActorSingleton::GetFinalParent()
 }
 
 
+/* static */ void AActorSingleton::InvalidateFinalParentCache()
+{
+	FinalParentCache.Reset();
+	++FinalParentCacheSerial;
+
+	/* Resolved FinalParent may change, so every TActorSingletonHandle must resolve again */
+	++UActorSingletonManager::RegistryGeneration;
+}
+
+
+/* static */ int32 AActorSingleton::GetSlotIndex(const TSubclassOf<AActorSingleton> FinalParent)
+{
+	if (!FinalParent)
+	{
+		return INDEX_NONE;
+	}
+
+	const TObjectKey<UClass> ClassKey(FinalParent.Get());
+	if (const int32* const Slot = SlotIndices.Find(ClassKey))
+	{
+		return *Slot;
+	}
+
+	return SlotIndices.Add(ClassKey, SlotIndices.Num());
+}
+
+
 /* static */ UActorSingletonManager* UActorSingletonManager::Get(const UObject* const WorldContext)
 {
+#if ACTORSINGLETON_LOOKUP_VALIDATION
 	check(IsValid(WorldContext))
+#endif //ACTORSINGLETON_LOOKUP_VALIDATION
+
+	/* Both casts are just a check of the class' cast flags */
+	if (const UWorld* const World = Cast<UWorld>(WorldContext))
+	{
+		return Get(World);
+	}
+	if (const AActor* const Actor = Cast<AActor>(WorldContext))
+	{
+		return Get(Actor);
+	}
+
 	const UWorld* const World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::Assert);
-	return World->GetSubsystem<UActorSingletonManager>();
+	return Get(World);
+}
+
+
+/* static */ UActorSingletonManager* UActorSingletonManager::Get(const AActor* const Actor)
+{
+#if ACTORSINGLETON_LOOKUP_VALIDATION
+	check(IsValid(Actor))
+	const UWorld* const World = Actor->GetWorld();
+	check(World)
+	return Get(World);
+#else
+	return Get(Actor->GetWorld());
+#endif //ACTORSINGLETON_LOOKUP_VALIDATION
+}
+
+
+/* static */ UActorSingletonManager* UActorSingletonManager::Get(const UWorld* const World)
+{
+#if ACTORSINGLETON_LOOKUP_VALIDATION
+	check(World)
+#endif //ACTORSINGLETON_LOOKUP_VALIDATION
+	if (World == CachedWorld)
+	{
+		return CachedManager;
+	}
+
+	/* 'nullptr' is never cached, as the Manager may still be on its way (see UActorSingletonManager::PostInitialize) */
+	UActorSingletonManager* const ActorSingletonManager = World->GetSubsystem<UActorSingletonManager>();
+	if (ActorSingletonManager)
+	{
+		CachedWorld = World;
+		CachedManager = ActorSingletonManager;
+	}
+	return ActorSingletonManager;
+}
+
+
+void UActorSingletonManager::RegisterInstance(AActorSingleton* const Instance, const int32 Slot)
+{
+	check(Slot != INDEX_NONE)
+
+	if (!InstanceSlots.IsValidIndex(Slot))
+	{
+		InstanceSlots.SetNumZeroed(Slot + 1);
+	}
+
+	/* Previous instance (if any) is already invalid, but let's not leave it thinking that it is still registered */
+	if (AActorSingleton* const PreviousInstance = InstanceSlots[Slot])
+	{
+		PreviousInstance->RegisteredSlot = INDEX_NONE;
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_ActorSingleton_RegisteredInstances);
+	}
+
+	InstanceSlots[Slot] = Instance;
+	Instance->RegisteredSlot = Slot;
+	MarkRegistryChanged();
+
+	ACTORSINGLETON_TRACE(InstanceRegistered, Instance, Instance->GetFinalParent());
+
+	/* Previous instance could only still be here if it hasn't been evicted properly, so it's never valid */
+	NotifyInstanceChanged(Slot, Instance, nullptr);
+}
+
+
+void UActorSingletonManager::UnregisterInstance(AActorSingleton* const Instance)
+{
+	const int32 Slot = Instance->RegisteredSlot;
+	if (InstanceSlots.IsValidIndex(Slot) && InstanceSlots[Slot] == Instance)
+	{
+		InstanceSlots[Slot] = nullptr;
+		MarkRegistryChanged();
+		DEC_DWORD_STAT(STAT_ActorSingleton_RegisteredInstances);
+		ACTORSINGLETON_TRACE(InstanceEvicted, Instance);
+		NotifyInstanceChanged(Slot, nullptr, Instance);
+	}
+}
+
+
+void UActorSingletonManager::NotifyInstanceChanged(const int32 Slot, AActorSingleton* const NewInstance, AActorSingleton* const OldInstance)
+{
+	if (BatchDepth > 0)
+	{
+		DeferredInstanceChanges.Add({ Slot, NewInstance, OldInstance });
+		return;
+	}
+
+	BroadcastInstanceChanged(Slot, NewInstance, OldInstance);
+
+	/* Instance may have been evicted already, by one of the listeners or later within the same batch */
+	if (NewInstance && NewInstance->RegisteredSlot == Slot)
+	{
+		FulfillInstancePromises(NewInstance);
+	}
+}
+
+
+void UActorSingletonManager::BroadcastInstanceChanged(const int32 Slot, AActorSingleton* const NewInstance, AActorSingleton* const OldInstance)
+{
+	const TUniquePtr<FActorSingletonInstanceChangedEvents>* const FoundEvents = InstanceChangedEvents.Find(Slot);
+	if (!FoundEvents)
+	{
+		return;
+	}
+
+	/* Entry itself never moves (unlike the map holding it), so it can be used after any of the listeners has been called */
+	FActorSingletonInstanceChangedEvents* const Events = FoundEvents->Get();
+	Events->Native.Broadcast(NewInstance, OldInstance);
+
+	/* Copy, as any of the listeners may bind/unbind while we're iterating */
+	const TArray<FOnActorSingletonInstanceChangedDynamic> DynamicEvents = Events->Dynamic;
+	for (const FOnActorSingletonInstanceChangedDynamic& Event : DynamicEvents)
+	{
+		Event.ExecuteIfBound(NewInstance, OldInstance);
+	}
+}
+
+
+FOnActorSingletonInstanceChanged& UActorSingletonManager::OnInstanceChanged(const TSubclassOf<AActorSingleton> Class)
+{
+	return FindOrAddInstanceChangedEvents(Class).Native;
+}
+
+
+TFuture<AActorSingleton*> UActorSingletonManager::WaitForInstance(const TSubclassOf<AActorSingleton> Class)
+{
+	check(Class)
+	AActorSingleton* const CDO = Class->GetDefaultObject<AActorSingleton>();
+	const int32 Slot = AActorSingleton::GetSlotIndex(CDO->GetFinalParent());
+	if (!ensure(Slot != INDEX_NONE))
+	{
+		return MakeFulfilledPromise<AActorSingleton*>(nullptr).GetFuture();
+	}
+
+	AActorSingleton* const CurrentInstance = GetInstanceAtSlot(Slot);
+	if (IsValid(CurrentInstance) && CurrentInstance->IsA(Class))
+	{
+		return MakeFulfilledPromise<AActorSingleton*>(CurrentInstance).GetFuture();
+	}
+
+	FInstancePromise& Entry = InstancePromises.AddDefaulted_GetRef();
+	Entry.Class = Class;
+	return Entry.Promise.GetFuture();
+}
+
+
+void UActorSingletonManager::FulfillInstancePromises(AActorSingleton* const Instance)
+{
+	if (InstancePromises.IsEmpty())
+	{
+		return;
+	}
+
+	/* Take them out before fulfilling anything, as continuations are free to wait for another instance */
+	TArray<FInstancePromise> Fulfilled;
+	for (int32 Index = InstancePromises.Num() - 1; Index >= 0; --Index)
+	{
+		if (Instance->IsA(InstancePromises[Index].Class))
+		{
+			Fulfilled.Add(MoveTemp(InstancePromises[Index]));
+			InstancePromises.RemoveAtSwap(Index, 1, false);
+		}
+	}
+
+	for (FInstancePromise& Entry : Fulfilled)
+	{
+		Entry.Promise.SetValue(Instance);
+	}
+}
+
+
+FActorSingletonInstanceChangedEvents& UActorSingletonManager::FindOrAddInstanceChangedEvents(const TSubclassOf<AActorSingleton> Class)
+{
+	check(Class)
+	AActorSingleton* const CDO = Class->GetDefaultObject<AActorSingleton>();
+	const int32 Slot = AActorSingleton::GetSlotIndex(CDO->GetFinalParent());
+	check(Slot != INDEX_NONE)
+
+	TUniquePtr<FActorSingletonInstanceChangedEvents>& Events = InstanceChangedEvents.FindOrAdd(Slot);
+	if (!Events)
+	{
+		Events = MakeUnique<FActorSingletonInstanceChangedEvents>();
+	}
+	return *Events;
+}
+
+
+/* static */ void UActorSingletonManager::AddPendingInstance(AActorSingleton* const Actor)
+{
+	const ULevel* const Level = Actor->GetLevel();
+	if (!Level)
+	{
+		return;
+	}
+
+	PendingInstances.FindOrAdd(Level).AddUnique(Actor);
+}
+
+
+void UActorSingletonManager::RegisterPendingInstances(const ULevel* const Level)
+{
+	TArray<TWeakObjectPtr<AActorSingleton>> LevelPendingInstances;
+	if (!PendingInstances.RemoveAndCopyValue(Level, LevelPendingInstances))
+	{
+		return;
+	}
+
+	BeginBatch();
+	for (const TWeakObjectPtr<AActorSingleton>& WeakActor : LevelPendingInstances)
+	{
+		if (AActorSingleton* const Actor = WeakActor.Get())
+		{
+			Actor->TryBecomeNewInstanceOrSelfDestroy();
+		}
+	}
+	EndBatch();
+}
+
+
+void UActorSingletonManager::UnregisterLevelInstances(const ULevel* const Level)
+{
+	BeginBatch();
+	for (int32 Slot = 0; Slot < InstanceSlots.Num(); ++Slot)
+	{
+		AActorSingleton*& Instance = InstanceSlots[Slot];
+		if (Instance && Instance->GetLevel() == Level)
+		{
+			DEC_DWORD_STAT(STAT_ActorSingleton_RegisteredInstances);
+			ACTORSINGLETON_TRACE(InstanceEvicted, Instance);
+			Instance->RegisteredSlot = INDEX_NONE;
+			AddPendingInstance(Instance);
+			NotifyInstanceChanged(Slot, nullptr, Instance);
+			Instance = nullptr;
+			MarkRegistryChanged();
+		}
+	}
+	EndBatch();
+}
+
+
+void UActorSingletonManager::BeginBatch()
+{
+	++BatchDepth;
+}
+
+
+void UActorSingletonManager::EndBatch()
+{
+	check(BatchDepth > 0)
+	if (--BatchDepth > 0)
+	{
+		return;
+	}
+
+	if (bSnapshotDirty)
+	{
+		PublishSnapshot();
+	}
+
+	/* Taken out first, as any of the listeners may start another batch */
+	const TArray<FInstanceChange> Changes = MoveTemp(DeferredInstanceChanges);
+	for (const FInstanceChange& Change : Changes)
+	{
+		NotifyInstanceChanged(Change.Slot, Change.NewInstance, Change.OldInstance);
+	}
+}
+
+
+void UActorSingletonManager::MarkRegistryChanged()
+{
+	++RegistryGeneration;
+	bSnapshotDirty = true;
+	if (BatchDepth == 0)
+	{
+		PublishSnapshot();
+	}
+}
+
+
+void UActorSingletonManager::PublishSnapshot()
+{
+	check(IsInGameThread())
+	bSnapshotDirty = false;
+
+	auto* const NewSnapshot = new FActorSingletonSnapshot();
+	for (AActorSingleton* const Instance : InstanceSlots)
+	{
+		if (!Instance)
+		{
+			continue;
+		}
+
+		const UClass* const FinalParent = Instance->GetFinalParent();
+		for (const UClass* ItClass = Instance->GetClass(); ItClass; ItClass = ItClass->GetSuperClass())
+		{
+			NewSnapshot->Instances.Add(ItClass, Instance);
+			if (ItClass == FinalParent)
+			{
+				break;
+			}
+		}
+	}
+
+	/* Readers that have already loaded the previous snapshot are counted in ActiveReaders,
+	*	the ones that come after this exchange will only ever see the new one. */
+	const FActorSingletonSnapshot* const PreviousSnapshot = Snapshot.exchange(NewSnapshot);
+	if (PreviousSnapshot)
+	{
+		RetiredSnapshots.Add({ TUniquePtr<const FActorSingletonSnapshot>(PreviousSnapshot), ReaderEpoch.load() });
+	}
+
+	FreeRetiredSnapshots(false);
+}
+
+
+void UActorSingletonManager::FreeRetiredSnapshots(const bool bWait)
+{
+	check(IsInGameThread())
+
+	while (!RetiredSnapshots.IsEmpty())
+	{
+		const uint32 Epoch = ReaderEpoch.load();
+		RetiredSnapshots.RemoveAll([Epoch](const FRetiredSnapshot& Retired) { return Epoch - Retired.Epoch >= 2; });
+		if (RetiredSnapshots.IsEmpty())
+		{
+			break;
+		}
+
+		/* Readers of the previous epoch are done, so nobody can enter it anymore, and we can move on to the next one */
+		if (ActiveReaders[(Epoch - 1) & 1].load() == 0)
+		{
+			ReaderEpoch.store(Epoch + 1);
+		}
+		/* Lookups are a single map probe, so waiting here (only when the UWorld goes away) never takes long */
+		else if (bWait)
+		{
+			FPlatformProcess::YieldThread();
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+
+/* static */ const UActorSingletonManager* UActorSingletonManager::GetForAnyThread(const UObject* const WorldContext)
+{
+	/* UWorld::GetSubsystem must not be called off the game thread, as the subsystem collection may change under it at any time */
+	check(IsInGameThread())
+	return Get(WorldContext);
+}
+
+
+AActorSingleton* UActorSingletonManager::GetInstanceAnyThread(const UClass* const Class) const
+{
+	/* Epoch may advance between loading and registering under it, in which case game thread may not be waiting for us,
+	*	so we only proceed once we're registered under the epoch that is still current */
+	uint32 Epoch = ReaderEpoch.load();
+	for (;;)
+	{
+		ActiveReaders[Epoch & 1].fetch_add(1);
+		const uint32 CurrentEpoch = ReaderEpoch.load();
+		if (CurrentEpoch == Epoch)
+		{
+			break;
+		}
+
+		ActiveReaders[Epoch & 1].fetch_sub(1);
+		Epoch = CurrentEpoch;
+	}
+
+	AActorSingleton* Instance = nullptr;
+	if (const FActorSingletonSnapshot* const CurrentSnapshot = Snapshot.load())
+	{
+		Instance = CurrentSnapshot->Instances.FindRef(Class);
+	}
+
+	ActiveReaders[Epoch & 1].fetch_sub(1);
+	return Instance;
+}
+
+
+void UActorSingletonManager::HandleLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (Level && World == GetWorld())
+	{
+		RegisterPendingInstances(Level);
+	}
+}
+
+
+void UActorSingletonManager::HandlePreLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	/* 'nullptr' Level means that the whole UWorld is going away, in which case there is nothing to batch */
+	if (Level && World == GetWorld())
+	{
+		UnregisterLevelInstances(Level);
+	}
+}
+
+
+void UActorSingletonManager::HandleActorPreSpawnInitialization(AActor* Actor)
+{
+	AActorSingleton* const ActorSingleton = Cast<AActorSingleton>(Actor);
+	if (!ActorSingleton)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ActorSingleton_DuplicateResolution);
+	CSV_SCOPED_TIMING_STAT(ActorSingleton, DuplicateResolution);
+
+	if (!ActorSingleton->IsDuplicate())
+	{
+		return;
+	}
+
+	/* Components created in the constructor would get registered in AActor::PostSpawnInitialize,
+	*	right before AActor::PostActorCreated (where the duplicate gets destroyed), so we make sure they won't.
+	* This only covers native components. Whether construction scripts still run on the destroyed duplicate is up to the engine,
+	*	but even if they do, the duplicate is never registered, as CanBecomeInstance ignores Actors being destroyed. */
+	ActorSingleton->bRejectedOnSpawn = true;
+	for (UActorComponent* const Component : ActorSingleton->GetComponents())
+	{
+		Component->bAutoRegister = false;
+	}
+}
+
+
+/* virtual override */ void UActorSingletonManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LevelAddedToWorldHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UActorSingletonManager::HandleLevelAddedToWorld);
+	PreLevelRemovedFromWorldHandle = FWorldDelegates::PreLevelRemovedFromWorld.AddUObject(this, &UActorSingletonManager::HandlePreLevelRemovedFromWorld);
+
+	/* Duplicates placed into the Level Viewport must go through the Editor path in TryBecomeNewInstanceOrSelfDestroy,
+	*	so early rejection is only used in the Worlds that are actually playing. */
+	UWorld* const World = GetWorld();
+	if (!World->IsEditorWorld() || World->IsPlayInEditor())
+	{
+		ActorPreSpawnInitializationHandle = World->AddOnActorPreSpawnInitialization(
+			FOnActorSpawned::FDelegate::CreateUObject(this, &UActorSingletonManager::HandleActorPreSpawnInitialization));
+	}
+
+	RetiredSnapshotsEndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UActorSingletonManager::FreeRetiredSnapshotsAtEndOfFrame);
+
+#if ACTORSINGLETON_WITH_LOGGING
+	LogThrottleEndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UActorSingletonManager::FlushExpiredLogThrottles);
+#endif //ACTORSINGLETON_WITH_LOGGING
+
+#if CSV_PROFILER
+	RegistrySizeStatName = FName(*FString::Printf(TEXT("RegistrySize_%s"), *World->GetName()));
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UActorSingletonManager::RecordRegistrySize);
+#endif //CSV_PROFILER
+}
+
+
+/* virtual override */ void UActorSingletonManager::Deinitialize()
+{
+	/* Another UWorld may be allocated under the same address later on */
+	if (CachedManager == this)
+	{
+		CachedWorld = nullptr;
+		CachedManager = nullptr;
+	}
+
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedToWorldHandle);
+	FWorldDelegates::PreLevelRemovedFromWorld.Remove(PreLevelRemovedFromWorldHandle);
+	GetWorld()->RemoveOnActorPreSpawnInitialization(ActorPreSpawnInitializationHandle);
+
+#if ACTORSINGLETON_WITH_LOGGING
+	FCoreDelegates::OnEndFrame.Remove(LogThrottleEndFrameHandle);
+#endif //ACTORSINGLETON_WITH_LOGGING
+
+#if CSV_PROFILER
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+#endif //CSV_PROFILER
+
+	for (AActorSingleton* const Instance : InstanceSlots)
+	{
+		if (Instance)
+		{
+			DEC_DWORD_STAT(STAT_ActorSingleton_RegisteredInstances);
+			Instance->RegisteredSlot = INDEX_NONE;
+		}
+	}
+
+	/* Handles may point to instances from this UWorld, and they're about to go away */
+	++RegistryGeneration;
+
+	/* Nobody is ever going to register here again, so don't leave anyone waiting */
+	TArray<FInstancePromise> Abandoned = MoveTemp(InstancePromises);
+	for (FInstancePromise& Entry : Abandoned)
+	{
+		Entry.Promise.SetValue(nullptr);
+	}
+
+	/* Other threads may still be holding 'this' (see GetForAnyThread), from now on they only ever see 'nullptr',
+	*	and the last snapshot is freed once the ones that are still reading it are done */
+	FCoreDelegates::OnEndFrame.Remove(RetiredSnapshotsEndFrameHandle);
+	if (const FActorSingletonSnapshot* const LastSnapshot = Snapshot.exchange(nullptr))
+	{
+		RetiredSnapshots.Add({ TUniquePtr<const FActorSingletonSnapshot>(LastSnapshot), ReaderEpoch.load() });
+	}
+	FreeRetiredSnapshots(true);
+
+#if ACTORSINGLETON_WITH_LOGGING
+	const double Window = CVarLogAggregationWindow.GetValueOnGameThread();
+	for (TPair<TPair<TObjectKey<UClass>, EActorSingletonLogKind>, FActorSingletonLogThrottle>& Pair : LogThrottles)
+	{
+		FlushLogThrottle(Pair.Key.Value, Pair.Value, Window);
+	}
+	LogThrottles.Empty();
+#endif //ACTORSINGLETON_WITH_LOGGING
+
+	Super::Deinitialize();
+}
+
+
+#if ACTORSINGLETON_WITH_LOGGING
+bool UActorSingletonManager::ShouldLogInFull(const EActorSingletonLogKind Kind, const UClass* const FinalParent)
+{
+	const double Window = CVarLogAggregationWindow.GetValueOnGameThread();
+	if (Window <= 0.0)
+	{
+		return true;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	FActorSingletonLogThrottle& Throttle = LogThrottles.FindOrAdd({ TObjectKey<UClass>(FinalParent), Kind });
+
+	if (Now - Throttle.WindowStart < Window)
+	{
+		++Throttle.SuppressedCount;
+		return false;
+	}
+
+	FlushLogThrottle(Kind, Throttle, Window);
+	Throttle.ClassName = FinalParent->GetFName();
+	Throttle.WindowStart = Now;
+	return true;
+}
+
+
+void UActorSingletonManager::FlushLogThrottle(const EActorSingletonLogKind Kind, FActorSingletonLogThrottle& Throttle, const double Window) const
+{
+	if (Throttle.SuppressedCount <= 0)
+	{
+		return;
+	}
+
+	/* Summary is usually logged a bit after the window is over, so it reports the window itself, not the time elapsed since it started */
+	switch (Kind)
+	{
+	case EActorSingletonLogKind::NewInstance:
+		UE_LOGFMT(ActorSingleton, Warning,
+			"{Count} more Actors became a Singleton instance of class '{ClassName}' in the World '{WorldName}' in the last {Seconds} seconds!",
+			Throttle.SuppressedCount, Throttle.ClassName, GetWorld()->GetFName(), Window);
+		break;
+	case EActorSingletonLogKind::Duplicate:
+		UE_LOGFMT(ActorSingleton, Error,
+			"{Count} more duplicates of '{ClassName}' have been destroyed in the World '{WorldName}' in the last {Seconds} seconds!",
+			Throttle.SuppressedCount, Throttle.ClassName, GetWorld()->GetFName(), Window);
+		break;
+	}
+
+	Throttle.SuppressedCount = 0;
+}
+
+
+void UActorSingletonManager::FlushExpiredLogThrottles()
+{
+	if (LogThrottles.IsEmpty())
+	{
+		return;
+	}
+
+	const double Window = CVarLogAggregationWindow.GetValueOnGameThread();
+	const double Now = FPlatformTime::Seconds();
+	for (auto It = LogThrottles.CreateIterator(); It; ++It)
+	{
+		if (Now - It->Value.WindowStart >= Window)
+		{
+			FlushLogThrottle(It->Key.Value, It->Value, Window);
+			It.RemoveCurrent();
+		}
+	}
 }
+#endif //ACTORSINGLETON_WITH_LOGGING
 
 
-void UActorSingletonManager::FindInstancesAndDestroyDuplicates()
+#if CSV_PROFILER
+void UActorSingletonManager::RecordRegistrySize()
 {
-	TArray<AActor*> PossibleInstances;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActorSingleton::StaticClass(), PossibleInstances);
-	for (AActor* Actor : PossibleInstances)
+	/* Resets the counters even when not capturing, so the first captured frame doesn't get everything counted before it */
+	FActorSingletonStats::FlushLookups();
+
+	if (!FCsvProfiler::Get()->IsCapturing())
+	{
+		return;
+	}
+
+	int32 RegistrySize = 0;
+	for (const AActorSingleton* const Instance : InstanceSlots)
 	{
-		static_cast<AActorSingleton*>(Actor)->TryBecomeNewInstanceOrSelfDestroy();
+		RegistrySize += Instance ? 1 : 0;
 	}
+
+	FCsvProfiler::RecordCustomStat(RegistrySizeStatName, CSV_CATEGORY_INDEX(ActorSingleton), RegistrySize, ECsvCustomStatOp::Set);
+}
+#endif //CSV_PROFILER
+
+
+/* static */ bool UActorSingletonManager::ShouldExistIn(const UObject* const WorldContext)
+{
+	const UWorld* const World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::ReturnNull);
+	return World && GetDefault<UActorSingletonSettings>()->SupportedWorldTypes.Contains(World->WorldType);
+}
+
+
+/* virtual override */ bool UActorSingletonManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	/* Every UWorld gets its own Manager otherwise, including Editor previews and thumbnails that can never hold any singleton */
+	return GetDefault<UActorSingletonSettings>()->SupportedWorldTypes.Contains(WorldType);
 }
 
 
 /* virtual override */ void UActorSingletonManager::PostInitialize()
 {
 	Super::PostInitialize();
-	FindInstancesAndDestroyDuplicates();
+	ACTORSINGLETON_TRACE_SCOPE(UActorSingletonManager::PostInitialize);
+#if ACTORSINGLETON_TRACE_ENABLED
+	const uint64 StartCycle = FPlatformTime::Cycles64();
+#endif //ACTORSINGLETON_TRACE_ENABLED
+
+	for (const ULevel* const Level : GetWorld()->GetLevels())
+	{
+		RegisterPendingInstances(Level);
+	}
+
+	/* Levels can get loaded without ever being added to any UWorld (e.g. when they're just being inspected),
+	*	so this is a good moment to forget about all of the queues that can't be used anymore. */
+	for (auto It = PendingInstances.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	ACTORSINGLETON_TRACE(ManagerInitialized, GetWorld(), StartCycle, FPlatformTime::Cycles64());
 }
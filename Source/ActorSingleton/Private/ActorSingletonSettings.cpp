@@ -0,0 +1,15 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#include "ActorSingletonSettings.h"
+
+
+UActorSingletonSettings::UActorSingletonSettings()
+{
+	SupportedWorldTypes = { EWorldType::Game, EWorldType::PIE, EWorldType::Editor };
+}
+
+
+/* virtual override */ FName UActorSingletonSettings::GetCategoryName() const
+{
+	return TEXT("Plugins");
+}
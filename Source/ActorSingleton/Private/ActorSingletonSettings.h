@@ -0,0 +1,29 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "Engine/EngineTypes.h"
+#include "ActorSingletonSettings.generated.h"
+
+/* Project Settings -> Plugins -> Actor Singleton */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Actor Singleton"))
+class UActorSingletonSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+
+	UActorSingletonSettings();
+
+	/* Types of UWorld that get a UActorSingletonManager (and so can hold Actor Singletons).
+	* Worlds of any other type (Editor previews, Blueprint Editor viewports, thumbnails, inactive Worlds...) skip it completely,
+	*	Actor Singletons placed there are never registered nor checked for duplicates. */
+	UPROPERTY(Config, EditAnywhere, Category = "Actor Singleton")
+	TArray<TEnumAsByte<EWorldType::Type>> SupportedWorldTypes;
+
+	//~ Begin UDeveloperSettings Interface
+	virtual FName GetCategoryName() const override;
+	//~ End UDeveloperSettings Interface
+};
@@ -0,0 +1,37 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#include "ActorSingletonStats.h"
+
+DEFINE_STAT(STAT_ActorSingleton_GetInstanceCalls);
+DEFINE_STAT(STAT_ActorSingleton_GetInstanceHits);
+DEFINE_STAT(STAT_ActorSingleton_GetInstanceMisses);
+DEFINE_STAT(STAT_ActorSingleton_DuplicatesRejected);
+DEFINE_STAT(STAT_ActorSingleton_RegisteredInstances);
+DEFINE_STAT(STAT_ActorSingleton_DuplicateResolution);
+
+CSV_DEFINE_CATEGORY_MODULE(ACTORSINGLETON_API, ActorSingleton, true);
+
+
+#if CSV_PROFILER
+int32 FActorSingletonStats::LookupHitsThisFrame = 0;
+int32 FActorSingletonStats::LookupMissesThisFrame = 0;
+
+
+/* static */ void FActorSingletonStats::FlushLookups()
+{
+	const int32 Hits = LookupHitsThisFrame;
+	const int32 Misses = LookupMissesThisFrame;
+	LookupHitsThisFrame = 0;
+	LookupMissesThisFrame = 0;
+
+	/* Every UActorSingletonManager flushes at the end of frame, only the first one finds anything to record */
+	if ((Hits == 0 && Misses == 0) || !FCsvProfiler::Get()->IsCapturing())
+	{
+		return;
+	}
+
+	CSV_CUSTOM_STAT(ActorSingleton, GetInstanceCalls, Hits + Misses, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(ActorSingleton, GetInstanceHits, Hits, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(ActorSingleton, GetInstanceMisses, Misses, ECsvCustomStatOp::Accumulate);
+}
+#endif //CSV_PROFILER
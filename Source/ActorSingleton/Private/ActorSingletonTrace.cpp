@@ -0,0 +1,113 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#include "ActorSingletonTrace.h"
+
+#if ACTORSINGLETON_TRACE_ENABLED
+
+#include "ActorSingleton.h"
+
+UE_TRACE_CHANNEL_DEFINE(ActorSingletonChannel)
+
+UE_TRACE_EVENT_BEGIN(ActorSingleton, InstanceRegistered)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, WorldName)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ClassName)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ActorName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(ActorSingleton, DuplicateDestroyed)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, WorldName)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ClassName)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ActorName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(ActorSingleton, InstanceEvicted)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, WorldName)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ClassName)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ActorName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(ActorSingleton, ManagerInitialized)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, WorldName)
+UE_TRACE_EVENT_END()
+
+
+/* static */ void FActorSingletonTrace::OutputInstanceRegistered(const AActorSingleton* const Instance, const UClass* const FinalParent)
+{
+	/* Names are only built when someone actually listens to the channel */
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(ActorSingletonChannel))
+	{
+		return;
+	}
+
+	const FString WorldName = GetNameSafe(Instance->GetWorld());
+	const FString ClassName = GetNameSafe(FinalParent);
+	const FString ActorName = AActor::GetDebugName(Instance);
+
+	UE_TRACE_LOG(ActorSingleton, InstanceRegistered, ActorSingletonChannel)
+		<< InstanceRegistered.Cycle(FPlatformTime::Cycles64())
+		<< InstanceRegistered.WorldName(*WorldName, WorldName.Len())
+		<< InstanceRegistered.ClassName(*ClassName, ClassName.Len())
+		<< InstanceRegistered.ActorName(*ActorName, ActorName.Len());
+}
+
+
+/* static */ void FActorSingletonTrace::OutputDuplicateDestroyed(const AActorSingleton* const Duplicate, const UClass* const FinalParent)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(ActorSingletonChannel))
+	{
+		return;
+	}
+
+	const FString WorldName = GetNameSafe(Duplicate->GetWorld());
+	const FString ClassName = GetNameSafe(FinalParent);
+	const FString ActorName = AActor::GetDebugName(Duplicate);
+
+	UE_TRACE_LOG(ActorSingleton, DuplicateDestroyed, ActorSingletonChannel)
+		<< DuplicateDestroyed.Cycle(FPlatformTime::Cycles64())
+		<< DuplicateDestroyed.WorldName(*WorldName, WorldName.Len())
+		<< DuplicateDestroyed.ClassName(*ClassName, ClassName.Len())
+		<< DuplicateDestroyed.ActorName(*ActorName, ActorName.Len());
+}
+
+
+/* static */ void FActorSingletonTrace::OutputInstanceEvicted(const AActorSingleton* const Instance)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(ActorSingletonChannel))
+	{
+		return;
+	}
+
+	/* Evicted instance may already be half-destroyed, so we don't resolve its FinalParent here */
+	const FString WorldName = GetNameSafe(Instance->GetWorld());
+	const FString ClassName = GetNameSafe(Instance->GetClass());
+	const FString ActorName = AActor::GetDebugName(Instance);
+
+	UE_TRACE_LOG(ActorSingleton, InstanceEvicted, ActorSingletonChannel)
+		<< InstanceEvicted.Cycle(FPlatformTime::Cycles64())
+		<< InstanceEvicted.WorldName(*WorldName, WorldName.Len())
+		<< InstanceEvicted.ClassName(*ClassName, ClassName.Len())
+		<< InstanceEvicted.ActorName(*ActorName, ActorName.Len());
+}
+
+
+/* static */ void FActorSingletonTrace::OutputManagerInitialized(const UWorld* const World, const uint64 StartCycle, const uint64 EndCycle)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(ActorSingletonChannel))
+	{
+		return;
+	}
+
+	const FString WorldName = GetNameSafe(World);
+
+	UE_TRACE_LOG(ActorSingleton, ManagerInitialized, ActorSingletonChannel)
+		<< ManagerInitialized.StartCycle(StartCycle)
+		<< ManagerInitialized.EndCycle(EndCycle)
+		<< ManagerInitialized.WorldName(*WorldName, WorldName.Len());
+}
+
+#endif //ACTORSINGLETON_TRACE_ENABLED
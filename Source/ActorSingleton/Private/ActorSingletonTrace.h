@@ -0,0 +1,43 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+class AActorSingleton;
+
+/*================================================================================
+=	Actor Singleton Trace:
+=
+=	Unreal Insights support for AActorSingleton and UActorSingletonManager.
+=	Enable it with '-trace=cpu,ActorSingleton' (or 'Trace.Enable ActorSingleton' in the console),
+=		it adds CPU scopes to the lookups and events for every change happening in the registry.
+=
+================================================================================*/
+
+#define ACTORSINGLETON_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if ACTORSINGLETON_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(ActorSingletonChannel)
+
+/* Emits events into the ActorSingleton trace channel, use it through ACTORSINGLETON_TRACE macro */
+struct FActorSingletonTrace
+{
+	static void OutputInstanceRegistered(const AActorSingleton* const Instance, const UClass* const FinalParent);
+	static void OutputDuplicateDestroyed(const AActorSingleton* const Duplicate, const UClass* const FinalParent);
+	static void OutputInstanceEvicted(const AActorSingleton* const Instance);
+	static void OutputManagerInitialized(const UWorld* const World, const uint64 StartCycle, const uint64 EndCycle);
+};
+
+#define ACTORSINGLETON_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, ActorSingletonChannel)
+#define ACTORSINGLETON_TRACE(Event, ...) FActorSingletonTrace::Output##Event(__VA_ARGS__)
+
+#else
+
+#define ACTORSINGLETON_TRACE_SCOPE(Name)
+#define ACTORSINGLETON_TRACE(Event, ...)
+
+#endif //ACTORSINGLETON_TRACE_ENABLED
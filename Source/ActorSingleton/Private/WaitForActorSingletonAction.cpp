@@ -0,0 +1,49 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#include "WaitForActorSingletonAction.h"
+
+
+/* static */ UWaitForActorSingletonAction* UWaitForActorSingletonAction::WaitForActorSingleton(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class)
+{
+	UWaitForActorSingletonAction* const Action = NewObject<UWaitForActorSingletonAction>();
+	Action->WorldContext = WorldContext;
+	Action->Class = Class;
+	Action->RegisterWithGameInstance(WorldContext);
+	return Action;
+}
+
+
+/* virtual override */ void UWaitForActorSingletonAction::Activate()
+{
+	/* Continuation may run right away (if the instance already exists) or much later, even after 'this' got cancelled.
+	* It runs with 'nullptr' at the latest when the UWorld goes away, as the Manager fulfills everything on Deinitialize,
+	*	or immediately, if there is no Manager at all (see UActorSingletonSettings). */
+	AActorSingleton::WaitForInstance(WorldContext.Get(), Class).Next(
+		[WeakThis = TWeakObjectPtr<UWaitForActorSingletonAction>(this)](AActorSingleton* const Instance)
+		{
+			if (UWaitForActorSingletonAction* const This = WeakThis.Get())
+			{
+				This->HandleInstance(Instance);
+			}
+		});
+}
+
+
+void UWaitForActorSingletonAction::HandleInstance(AActorSingleton* const Instance)
+{
+	if (!IsActive())
+	{
+		return;
+	}
+
+	if (Instance)
+	{
+		OnRegistered.Broadcast(Instance);
+	}
+	else
+	{
+		OnAbandoned.Broadcast(nullptr);
+	}
+
+	SetReadyToDestroy();
+}
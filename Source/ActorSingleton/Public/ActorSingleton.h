@@ -3,10 +3,77 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/World.h"
+#include "ActorSingletonStats.h"
+#include "Async/Future.h"
+#include <atomic>
+#include <type_traits>
 #include "ActorSingleton.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(ActorSingleton, Log, All);
 
+class AActorSingleton;
+
+/* Fired when the instance of some FinalParent changes within the UWorld.
+* NewInstance is 'nullptr' when the instance has been evicted, OldInstance is 'nullptr' when there was none (or it's already gone). */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnActorSingletonInstanceChanged, AActorSingleton* /*NewInstance*/, AActorSingleton* /*OldInstance*/);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnActorSingletonInstanceChangedDynamic, AActorSingleton*, NewInstance, AActorSingleton*, OldInstance);
+
+/* State of a single "Get Actor Singleton (Cached)" Blueprint node, see AActorSingleton::GetInstanceCached
+* Stored in a hidden member variable that the node adds to the Blueprint class, one per node. */
+USTRUCT(BlueprintType, meta = (BlueprintInternalUseOnly = "true"))
+struct ACTORSINGLETON_API FActorSingletonCachedReference
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TObjectPtr<AActorSingleton> Instance = nullptr;
+
+	/* UActorSingletonManager::GetRegistryGeneration at the time Instance was resolved, 0 if it never was */
+	uint32 Generation = 0;
+
+	/* AActorSingleton::FinalParentCacheSerial at the time Instance was resolved */
+	uint32 FinalParentCacheSerial = 0;
+};
+
+/* Set to 0 to compile out the logs about new instances and destroyed duplicates.
+* Off in Shipping by default, can only be overridden globally, via GlobalDefinitions in your Target file (see README),
+*	as every module including this header must see the same value.
+* It never changes the layout of any class, only the code that gets compiled. */
+#ifndef ACTORSINGLETON_WITH_LOGGING
+	#define ACTORSINGLETON_WITH_LOGGING !UE_BUILD_SHIPPING
+#endif
+
+/* Set to 0 to compile the lookups (AActorSingleton::GetInstance and its overloads) down to the bare minimum:
+*	no ensure/check about the WorldContext, missing UActorSingletonManager or FinalParent, just 'nullptr' returned where it's cheap to do so.
+* Same goes for the checks in UActorSingletonManager::Get, which every lookup (and registration) goes through.
+* Passing an invalid WorldContext is then undefined behavior, so keep it on wherever you're still catching bugs.
+* Off in Shipping and Test by default, can only be overridden globally, via GlobalDefinitions in your Target file (see README). */
+#ifndef ACTORSINGLETON_LOOKUP_VALIDATION
+	#define ACTORSINGLETON_LOOKUP_VALIDATION !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+/* Declares the class as a singleton root (FinalParent of itself and all of its sub-classes) at compile time.
+* Put it right after GENERATED_BODY:
+*	UCLASS()
+*	class AMyDirector : public AActorSingleton
+*	{
+*		GENERATED_BODY()
+*		ACTORSINGLETON_ROOT(AMyDirector)
+*	};
+* IsFinalParent is never called for such classes (nor for any of their sub-classes),
+*	and AActorSingleton::GetInstance<T> resolves the slot without touching any CDO, see TActorSingletonRoot.
+* Only one class in the hierarchy can be declared this way, nesting the roots fails to compile.
+* Blueprint equivalent is AActorSingleton::bSingletonRoot */
+#define ACTORSINGLETON_ROOT(ClassName) \
+	static_assert(std::is_same_v<ClassName, ThisClass>, "ACTORSINGLETON_ROOT must name the class it is used in"); \
+	static_assert(std::is_void_v<typename Super::FActorSingletonRoot>, "ACTORSINGLETON_ROOT can't be used in a sub-class of another declared root"); \
+public: \
+	using FActorSingletonRoot = ClassName; \
+	virtual UClass* GetDeclaredSingletonRoot() const override { return ClassName::StaticClass(); } \
+private:
+
 /*================================================================================
 =	Actor Singleton:
 =
@@ -20,13 +87,34 @@ DECLARE_LOG_CATEGORY_EXTERN(ActorSingleton, Log, All);
 ================================================================================*/
 
 
-/* Minimal implementation of Unreal Module (boilerplate) */
+/* Minimal implementation of Unreal Module
+* Apart from the boilerplate, it only listens for events that may change the result of AActorSingleton::GetFinalParent
+*	(Hot Reload, Live Coding) and invalidates the cache kept by AActorSingleton.
+* Blueprint recompiles are handled the same way by ActorSingletonEditor module, see FActorSingletonEditorHooks */
 class FActorSingletonModule : public IModuleInterface
 {
 public:
-	virtual void StartupModule() override {};
-	virtual void ShutdownModule() override {};
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+private:
+	FDelegateHandle ReloadCompleteHandle;
+};
+
+
+#if WITH_EDITOR
+/* Everything that ActorSingletonEditor module hooks into,
+*	so the runtime module never has to depend on any editor module (nor include any of their headers). */
+struct ACTORSINGLETON_API FActorSingletonEditorHooks
+{
+	/* Called for every duplicate found in the Editor World (not in PIE), which must be deleted the way the Editor expects.
+	* If nobody is bound (e.g. in commandlets), the duplicate is simply destroyed. */
+	static TDelegate<void(AActorSingleton* /*Duplicate*/)> OnEditorDuplicateFound;
+
+	/* Must be called whenever the result of IsFinalParent may change (e.g. after Blueprint recompile) */
+	static void InvalidateFinalParentCache();
 };
+#endif //WITH_EDITOR
 
 
 /* An Actor that is expected to have only one instance within UWorld
@@ -37,6 +125,14 @@ class ACTORSINGLETON_API AActorSingleton : public AActor
 	GENERATED_BODY()
 
 	friend UActorSingletonManager;
+	friend FActorSingletonModule;
+#if WITH_EDITOR
+	friend FActorSingletonEditorHooks;
+#endif //WITH_EDITOR
+#if WITH_DEV_AUTOMATION_TESTS
+	friend struct FActorSingletonTestAccess;
+#endif //WITH_DEV_AUTOMATION_TESTS
+	friend class UK2Node_GetActorSingletonCached;
 
 public:
 
@@ -44,7 +140,8 @@ public:
 	* By default, this function returns true for any non-Abstract class,
 	* 	but you can override it, if you wish to have base class that is abstract.
 	* This function only runs on CDO, so any conditional logic won't make any sense.
-	* It's basically static function. */
+	* It's basically static function.
+	* Not called at all for classes with a declared root, see ACTORSINGLETON_ROOT and AActorSingleton::bSingletonRoot */
 	UFUNCTION(BlueprintNativeEvent)
 	bool IsFinalParent() const;
 	virtual bool IsFinalParent_Implementation() const
@@ -54,6 +151,15 @@ public:
 		return !bAbstract;
 	};
 
+	/* Root declared with ACTORSINGLETON_ROOT, 'void' if there is none, see TActorSingletonRoot */
+	using FActorSingletonRoot = void;
+
+	/* Overridden by ACTORSINGLETON_ROOT, returns 'nullptr' if the root isn't declared at compile time */
+	virtual UClass* GetDeclaredSingletonRoot() const
+	{
+		return nullptr;
+	}
+
 	/* Override to provide a custom HEADER for the message which appears in the Editor
 	*	when you place a duplicate of Actor Singleton into Level Viewport
 	* Unlike IsFinalParent, this function runs on object instance, not on CDO. */
@@ -75,22 +181,99 @@ public:
 		meta = (DisplayName = "Get Actor Singleton Instance", DeterminesOutputType = "Class", WorldContext = "WorldContext"))
 	static AActorSingleton* GetInstance(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class);
 
-	/* Templated version of AActorSingleton::GetInstance */
+	/* Version of AActorSingleton::GetInstance used by the "Get Actor Singleton (Cached)" node (UK2Node_GetActorSingletonCached).
+	* Only resolves the instance again when the registry has changed since the last call, see UActorSingletonManager::GetRegistryGeneration,
+	*	otherwise it's just two compares, no matter how many pins the node feeds. */
+	UFUNCTION(BlueprintPure, meta = (BlueprintInternalUseOnly = "true", DeterminesOutputType = "Class", WorldContext = "WorldContext"))
+	static AActorSingleton* GetInstanceCached(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class, UPARAM(ref) FActorSingletonCachedReference& Cache);
+
+	/* Templated version of AActorSingleton::GetInstance
+	* Unlike the BP version, it doesn't resolve the FinalParent on each call.
+	* Every FinalParent gets a dense slot index which is cached per T, see AActorSingleton::GetSlotIndex<T>,
+	*	so the lookup itself is just a bounds-checked array load in UActorSingletonManager. */
 	template<class T>
-	static T* GetInstance(const UObject* WorldContext)
-	{
-		static_assert(TIsDerivedFrom<T, AActorSingleton>::IsDerived);
-		check(IsValid(WorldContext))
-		checkCode(
-			UObject* CDO = T::StaticClass()->GetDefaultObject();
-			TSubclassOf<AActorSingleton> FinalParent = static_cast<AActorSingleton*>(CDO)->GetFinalParent();
-			check(FinalParent)
-		)
-		return static_cast<T*>(AActorSingleton::GetInstance(WorldContext, T::StaticClass()));
-	}
+	static T* GetInstance(const UObject* WorldContext);
+
+	/* Overloads of AActorSingleton::GetInstance<T> for the most common contexts,
+	*	they resolve the UActorSingletonManager without going through UEngine::GetWorldFromContextObject */
+	template<class T>
+	static T* GetInstance(const UWorld* World);
+	template<class T>
+	static T* GetInstance(const AActor* Actor);
+
+	/* Thread-safe version of AActorSingleton::GetInstance<T>, can be called from any thread (async tasks, ParallelFor, physics callbacks).
+	* Manager of the UWorld can only be resolved on the game thread, so take it with UActorSingletonManager::GetForAnyThread
+	*	before dispatching the work, and hand it over together with the work.
+	* Lookup itself reads an immutable snapshot of the registry without taking any lock (see UActorSingletonManager::GetInstanceAnyThread),
+	*	so it may not see changes that the game thread is doing at the very same moment.
+	* Only returns the instance if it actually is a T (unlike GetInstance<T> it never casts a sibling class).
+	* Returns 'nullptr' for 'nullptr' Manager (UWorlds excluded by UActorSingletonSettings don't have any).
+	* Caller must keep the UWorld alive and must not hold the result across Garbage Collection (see FGCScopeGuard). */
+	template<class T>
+	static T* GetInstanceAnyThread(const UActorSingletonManager* Manager);
+
+	/* Spawns a new Actor of chosen class, but only if there is no instance of its FinalParent within current UWorld yet.
+	* If there is one, said instance is returned instead and nothing gets spawned,
+	*	so we never pay for constructing (and then destroying) a duplicate.
+	* If the existing instance is not of chosen class (e.g. it's a sibling class sharing the same FinalParent),
+	*	'nullptr' is returned and nothing gets spawned either, as the new Actor would be a duplicate anyway.
+	* This is a BP version of this function. For better typesafety in C++, use AActorSingleton::TrySpawnSingleton<T> */
+	UFUNCTION(BlueprintCallable,
+		meta = (DisplayName = "Try Spawn Actor Singleton", DeterminesOutputType = "Class", WorldContext = "WorldContext"))
+	static AActorSingleton* TrySpawnSingleton(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class, const FTransform& Transform);
+
+	/* Templated version of AActorSingleton::TrySpawnSingleton
+	* Returns 'nullptr' if the existing instance is not of chosen class (e.g. it's a sibling class sharing the same FinalParent). */
+	template<class T>
+	static T* TrySpawnSingleton(
+		const UObject* WorldContext,
+		const FTransform& Transform = FTransform::Identity,
+		const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters(),
+		TSubclassOf<T> Class = T::StaticClass());
+
+	/* Returns a future that gets fulfilled once an instance of T (or its subclass) is registered in current UWorld,
+	*	or right away, if there already is one. Fulfilled with 'nullptr' if the UWorld goes away before that happens.
+	* Instance of a sibling class (sharing the same FinalParent, but not a T) doesn't count: while it holds the slot,
+	*	the future stays pending, until said sibling is gone and an instance of T gets registered, or until the UWorld goes away.
+	* Meant to replace retrying GetInstance<T> on timers when the order of BeginPlay is not guaranteed.
+	* Continuations (TFuture::Next/Then) run on the game thread, right after the instance gets registered.
+	* For Blueprints, see UWaitForActorSingletonAction */
+	template<class T>
+	static TFuture<T*> WaitForInstance(const UObject* WorldContext);
+
+	/* Non-templated version of AActorSingleton::WaitForInstance<T>, waits for an instance of chosen class (or its subclass),
+	*	an instance of a sibling class sharing the same FinalParent is never taken for it.
+	* Fulfilled with 'nullptr' right away in the UWorlds where UActorSingletonManager doesn't exist. */
+	static TFuture<AActorSingleton*> WaitForInstance(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class);
+
+	/* Starts calling given Event every time the instance of chosen class' FinalParent gets registered or evicted in current UWorld,
+	*	so you don't have to poll AActorSingleton::GetInstance waiting for it.
+	* This is a BP version of UActorSingletonManager::OnInstanceChanged */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Bind On Actor Singleton Instance Changed", WorldContext = "WorldContext"))
+	static void BindOnInstanceChanged(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class, FOnActorSingletonInstanceChangedDynamic Event);
+
+	/* Stops calling the Event bound with AActorSingleton::BindOnInstanceChanged */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Unbind On Actor Singleton Instance Changed", WorldContext = "WorldContext"))
+	static void UnbindOnInstanceChanged(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class, FOnActorSingletonInstanceChangedDynamic Event);
+
+protected:
+
+	/* Blueprint version of ACTORSINGLETON_ROOT, makes this class a FinalParent without calling IsFinalParent.
+	* Value is inherited by sub-classes, and the highest class that has it set becomes the FinalParent. */
+	UPROPERTY(EditDefaultsOnly, Category = "Actor Singleton")
+	bool bSingletonRoot = false;
+
+public:
+
+	//~ Begin UObject Interface
+	virtual void PostLoad() override;
+	//~ End UObject Interface
 
 	//~ Begin AActor Interface
+	virtual void PostActorCreated() override;
 	virtual void OnConstruction(const FTransform& Transform) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Destroyed() override;
 	//~ End AActor Interface
 
 private:
@@ -100,7 +283,112 @@ private:
 		* Does nothing in few circumstances, e.g. when calling on CDO */
 	void TryBecomeNewInstanceOrSelfDestroy();
 
+	/* Shared implementation of both versions of AActorSingleton::TrySpawnSingleton */
+	static AActorSingleton* TrySpawnSingletonInternal(
+		const UObject* const WorldContext,
+		TSubclassOf<AActorSingleton> Class,
+		const FTransform& Transform,
+		const FActorSpawnParameters& SpawnParameters);
+
+	/* Returns 'true' if there already is another valid instance of 'this' FinalParent within current UWorld.
+	* Unlike TryBecomeNewInstanceOrSelfDestroy, it doesn't change anything. */
+	bool IsDuplicate();
+
+	/* Returns 'false' for the Actors that are never registered nor destroyed as duplicates (e.g. CDO or Transient ones).
+	* Shared by TryBecomeNewInstanceOrSelfDestroy and IsDuplicate, so both paths always agree on what they ignore. */
+	bool CanBecomeInstance() const;
+
+	/* Logs an error about 'this' being destroyed as a duplicate of given FinalParent */
+	void LogDestroyingDuplicate(const TSubclassOf<AActorSingleton> ParentClass) const;
+
+	/* Set by UActorSingletonManager when 'this' turns out to be a duplicate before it even started spawning,
+	*	see UActorSingletonManager::HandleActorPreSpawnInitialization */
+	bool bRejectedOnSpawn = false;
+
+	/* Evicts 'this' from UActorSingletonManager, if it is the registered instance.
+	* Safe to call multiple times, as it does nothing for Actors that aren't registered. */
+	void UnregisterFromManager();
+
+	/* Slot under which 'this' is registered in UActorSingletonManager, INDEX_NONE if it isn't.
+	* Intentionally not a UPROPERTY, so it never gets copied when duplicating the Actor. */
+	int32 RegisteredSlot = INDEX_NONE;
+
+	/* Returns the class that is used as a key for this Actor in UActorSingletonManager.
+	* Result is cached per UClass, so only the first call for each class walks the inheritance chain
+	*	and calls IsFinalParent. See AActorSingleton::FinalParentCache */
 	TSubclassOf<AActorSingleton> GetFinalParent();
+
+	/* Does the actual (slow) work for AActorSingleton::GetFinalParent, without touching the cache. */
+	static TSubclassOf<AActorSingleton> ResolveFinalParent(UClass* const Class);
+
+	/* Forgets every resolved FinalParent, so they will be resolved again on the next lookup.
+	* Called by FActorSingletonModule whenever Blueprint gets recompiled or C++ code gets reloaded,
+	*	since both can change what IsFinalParent returns for the given class. */
+	static void InvalidateFinalParentCache();
+
+	/* Maps every class that we have ever asked for its FinalParent to said FinalParent (can be 'nullptr').
+	* TObjectKey is used instead of raw pointer, so a class that has been garbage collected
+	*	can never be confused with a new class allocated under the same address.
+	* Game thread only, just like everything else in here. */
+	static TMap<TObjectKey<UClass>, TSubclassOf<AActorSingleton>> FinalParentCache;
+
+	/* Incremented on every AActorSingleton::InvalidateFinalParentCache,
+	* lets AActorSingleton::GetSlotIndex<T> know that its cached slot may be outdated.
+	* Starts from 1, so 0 can be used as "never resolved". */
+	static uint32 FinalParentCacheSerial;
+
+	/* Returns the slot of given FinalParent, assigning the next free one if it doesn't have any yet.
+	* Slots are never reused nor reassigned, so they stay valid for the whole lifetime of the module.
+	* Returns INDEX_NONE for 'nullptr'. */
+	static int32 GetSlotIndex(const TSubclassOf<AActorSingleton> FinalParent);
+
+	/* Slot of T's FinalParent, resolved only once (and after FinalParentCache gets invalidated).
+	* Slots are assigned at runtime (on first use of each type),
+	*	as there is no way to get dense indices across modules at compile time. */
+	template<class T>
+	static int32 GetSlotIndex();
+
+	/* Shared implementation of every AActorSingleton::GetInstance<T> overload,
+	*	TContext picks the matching UActorSingletonManager::Get overload at compile time */
+	template<class T, class TContext>
+	static T* GetInstanceInternal(const TContext* WorldContext);
+
+	/* Every FinalParent that has been given a slot, see AActorSingleton::GetSlotIndex */
+	static TMap<TObjectKey<UClass>, int32> SlotIndices;
+};
+
+
+/* Kinds of messages that UActorSingletonManager aggregates when they're repeated too often */
+enum class EActorSingletonLogKind : uint8
+{
+	NewInstance,
+	Duplicate,
+};
+
+
+/* Keeps track of the repeated messages about one FinalParent, see UActorSingletonManager::ShouldLogInFull */
+struct FActorSingletonLogThrottle
+{
+	FName ClassName;
+	double WindowStart = -DBL_MAX;
+	int32 SuppressedCount = 0;
+};
+
+
+/* Immutable copy of UActorSingletonManager's registry, published for the threads other than the game thread.
+* Once published, it never changes, so it can be read without any synchronization. */
+struct FActorSingletonSnapshot
+{
+	/* Every class between the class of a registered instance and its FinalParent (both inclusive), mapped to said instance */
+	TMap<const UClass*, AActorSingleton*> Instances;
+};
+
+
+/* Listeners of a single FinalParent, see UActorSingletonManager::OnInstanceChanged */
+struct FActorSingletonInstanceChangedEvents
+{
+	FOnActorSingletonInstanceChanged Native;
+	TArray<FOnActorSingletonInstanceChangedDynamic> Dynamic;
 };
 
 
@@ -113,24 +401,366 @@ class ACTORSINGLETON_API UActorSingletonManager : public UWorldSubsystem
 	GENERATED_BODY()
 
 	friend AActorSingleton;
+#if WITH_DEV_AUTOMATION_TESTS
+	friend struct FActorSingletonTestAccess;
+#endif //WITH_DEV_AUTOMATION_TESTS
 
 public:
 
+	//~ Begin USubsystem Interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
 	//~ Begin UWorldSubsystem Interface
 	virtual void PostInitialize() override;
 	//~ End UWorldSubsystem Interface
 
+	/* Returns 'true' if UWorld of given context is expected to have UActorSingletonManager,
+	*	see UActorSingletonSettings::SupportedWorldTypes
+	* Missing Manager is only worth an ensure in such UWorld. */
+	static bool ShouldExistIn(const UObject* const WorldContext);
+
+protected:
+
+	//~ Begin UWorldSubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	//~ End UWorldSubsystem Interface
+
+public:
+
+	/* Gets the Manager of given context, so it can be handed over to other threads, see AActorSingleton::GetInstanceAnyThread.
+	* Game thread only, call it before dispatching the work. Returns 'nullptr' in the UWorlds where Manager doesn't exist. */
+	static const UActorSingletonManager* GetForAnyThread(const UObject* const WorldContext);
+
+	/* Gets the instance of given class from the last published FActorSingletonSnapshot, can be called from any thread.
+	* Readers never block: they only announce themselves in UActorSingletonManager::ActiveReaders (under current ReaderEpoch)
+	*	for the duration of a single lookup, which keeps the game thread from freeing the snapshot they're reading.
+	* Nothing else is touched, so readers of different UWorlds never share anything. */
+	AActorSingleton* GetInstanceAnyThread(const UClass* const Class) const;
+
+	/* Delegate fired every time the instance of given class' FinalParent gets registered or evicted in this UWorld.
+	* Every class sharing the same FinalParent shares the same delegate. */
+	FOnActorSingletonInstanceChanged& OnInstanceChanged(const TSubclassOf<AActorSingleton> Class);
+
+	/* Non-templated version of AActorSingleton::WaitForInstance<T> */
+	TFuture<AActorSingleton*> WaitForInstance(const TSubclassOf<AActorSingleton> Class);
+
+	/* Changes every time an instance gets registered or evicted in any UWorld, see TActorSingletonHandle */
+	static uint32 GetRegistryGeneration()
+	{
+		return RegistryGeneration;
+	}
+
 private:
 
-	/* Gets all AActorSingleton in the current UWorld,
-	* and calls AActorSingleton::TryBecomeNewInstanceOrSelfDestroy on all of them. */
-	void FindInstancesAndDestroyDuplicates();
+	/* Notifies everyone listening to given slot (see UActorSingletonManager::OnInstanceChanged),
+	*	and fulfills the promises waiting for NewInstance, if it is still registered by then.
+	* In the middle of a batch (see BatchDepth), it's only queued and done once the batch is over. */
+	void NotifyInstanceChanged(const int32 Slot, AActorSingleton* const NewInstance, AActorSingleton* const OldInstance);
+
+	void BroadcastInstanceChanged(const int32 Slot, AActorSingleton* const NewInstance, AActorSingleton* const OldInstance);
+
+	FActorSingletonInstanceChangedEvents& FindOrAddInstanceChangedEvents(const TSubclassOf<AActorSingleton> Class);
+
+	/* Listeners, indexed by slot of the FinalParent they're listening to.
+	* Kept on the heap and never removed, so they stay where they are while being broadcast,
+	*	even if one of the listeners starts listening to another FinalParent and the map grows. */
+	TMap<int32, TUniquePtr<FActorSingletonInstanceChangedEvents>> InstanceChangedEvents;
+
+	struct FInstanceChange
+	{
+		int32 Slot = INDEX_NONE;
+		AActorSingleton* NewInstance = nullptr;
+		AActorSingleton* OldInstance = nullptr;
+	};
+
+	/* Changes made during current batch, in order, see UActorSingletonManager::NotifyInstanceChanged */
+	TArray<FInstanceChange> DeferredInstanceChanges;
+
+	/* Fulfills every promise waiting for given instance (see UActorSingletonManager::WaitForInstance) and forgets about it */
+	void FulfillInstancePromises(AActorSingleton* const Instance);
+
+	struct FInstancePromise
+	{
+		TSubclassOf<AActorSingleton> Class;
+		TPromise<AActorSingleton*> Promise;
+	};
+
+	/* Everyone waiting for an instance that isn't registered yet, fulfilled with 'nullptr' on Deinitialize */
+	TArray<FInstancePromise> InstancePromises;
+
+	/* Must be called after every change in UActorSingletonManager::InstanceSlots.
+	* Publishes a new FActorSingletonSnapshot, unless we're in the middle of a batch (see BatchDepth),
+	*	in which case the snapshot is published once the batch is over. */
+	void MarkRegistryChanged();
+
+	/* Registering/unregistering whole Levels is done in a batch: snapshot is published once, at the end,
+	*	and only then everyone gets notified, so listeners and promises always see the registry in a consistent state. */
+	void BeginBatch();
+	void EndBatch();
+
+	/* Builds a new FActorSingletonSnapshot from UActorSingletonManager::InstanceSlots and swaps it with the current one.
+	* Previous snapshot is retired, as some other thread may still be reading it. */
+	void PublishSnapshot();
+
+	/* Deletes retired snapshots that no reader can hold anymore, advancing UActorSingletonManager::ReaderEpoch where possible.
+	* Snapshot retired in epoch N is safe to delete once the epoch reaches N + 2: getting there requires every reader
+	*	that has started in epoch N - 1 or N to be done, and readers from any later epoch could have only seen a newer snapshot.
+	* Never waits for the readers, unless 'bWait' is set (used when this UWorld goes away).
+	* Also retried at the end of every frame (see UActorSingletonManager::FreeRetiredSnapshotsAtEndOfFrame),
+	*	so snapshots are reclaimed under a steady stream of readers, even when nothing else gets published. */
+	void FreeRetiredSnapshots(const bool bWait);
+
+	void FreeRetiredSnapshotsAtEndOfFrame()
+	{
+		FreeRetiredSnapshots(false);
+	}
+
+	/* Last published FActorSingletonSnapshot, owned by this Manager. */
+	std::atomic<const FActorSingletonSnapshot*> Snapshot { nullptr };
+
+	/* Readers register themselves under the parity of the epoch they have started in,
+	*	so the game thread only ever waits for the readers of one epoch to drain, not for a moment without any readers at all. */
+	std::atomic<uint32> ReaderEpoch { 0 };
+
+	/* Number of GetInstanceAnyThread calls that are in progress right now, per parity of UActorSingletonManager::ReaderEpoch. */
+	mutable std::atomic<int32> ActiveReaders[2] { 0, 0 };
+
+	struct FRetiredSnapshot
+	{
+		TUniquePtr<const FActorSingletonSnapshot> Snapshot;
+		uint32 Epoch = 0;
+	};
+
+	/* Snapshots that have been replaced, but may still be read by other threads, with the ReaderEpoch they were retired in. */
+	TArray<FRetiredSnapshot> RetiredSnapshots;
+	FDelegateHandle RetiredSnapshotsEndFrameHandle;
+
+	/* Greater than zero while registering/unregistering whole Levels, see UActorSingletonManager::BeginBatch */
+	int32 BatchDepth = 0;
+	bool bSnapshotDirty = false;
+
+	/* Incremented on every change in any registry (and when any Manager goes away).
+	* It's shared between all UWorlds, so checking it is a single load without resolving any UWorld first.
+	* Starts from 1, so 0 can be used as "never resolved". Game thread only. */
+	static uint32 RegistryGeneration;
+
+
+	/* Queues given Actor until UActorSingletonManager of its UWorld is able to register it,
+	*	see UActorSingletonManager::PendingInstances */
+	static void AddPendingInstance(AActorSingleton* const Actor);
+
+	/* Calls AActorSingleton::TryBecomeNewInstanceOrSelfDestroy on every Actor queued for given Level,
+	*	and forgets about said queue. */
+	void RegisterPendingInstances(const ULevel* const Level);
+
+	/* Evicts every instance that lives in given Level and queues it back as pending,
+	*	so it can be registered again if said Level gets added back to the UWorld (e.g. when it was only hidden). */
+	void UnregisterLevelInstances(const ULevel* const Level);
+
+	/* Streamed Levels and World Partition cells are processed in one batch when they become visible,
+	*	and in another one, right before they get removed from the UWorld. */
+	void HandleLevelAddedToWorld(ULevel* Level, UWorld* World);
+	void HandlePreLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+
+	/* Catches duplicates spawned during play, before any of their components get registered */
+	void HandleActorPreSpawnInitialization(AActor* Actor);
+
+	FDelegateHandle LevelAddedToWorldHandle;
+	FDelegateHandle PreLevelRemovedFromWorldHandle;
+	FDelegateHandle ActorPreSpawnInitializationHandle;
+
+#if ACTORSINGLETON_WITH_LOGGING
+	/* Returns 'true' if the message of given kind about given FinalParent should be logged in full.
+	* Only the first message within the 'ActorSingleton.LogAggregationWindow' is, the rest is just counted,
+	*	and reported as a single summary at the end of the frame in which the window is over (or when this UWorld goes away).
+	* Keeps a buggy spawner from flooding the log (and the frame time) with thousands of identical messages. */
+	bool ShouldLogInFull(const EActorSingletonLogKind Kind, const UClass* const FinalParent);
+
+	/* Logs the summary of everything that has been suppressed by given throttle and resets it */
+	void FlushLogThrottle(const EActorSingletonLogKind Kind, FActorSingletonLogThrottle& Throttle, const double Window) const;
+
+	/* Flushes and forgets the throttles whose window is over, so their summary doesn't wait for the next message. Runs every frame. */
+	void FlushExpiredLogThrottles();
+#endif //ACTORSINGLETON_WITH_LOGGING
+
+	/* Declared even without ACTORSINGLETON_WITH_LOGGING (and just left empty), so the layout of this class never depends on it */
+	TMap<TPair<TObjectKey<UClass>, EActorSingletonLogKind>, FActorSingletonLogThrottle> LogThrottles;
+	FDelegateHandle LogThrottleEndFrameHandle;
+
+#if CSV_PROFILER
+	/* Records the size of this UWorld's registry and the lookups counted this frame into the CSV profile, once per frame */
+	void RecordRegistrySize();
+
+	FName RegistrySizeStatName;
+	FDelegateHandle EndFrameHandle;
+#endif //CSV_PROFILER
 
 	/* Wrapper for UWorld::GetSubsystem<UActorSingletonManager>
-	* May return 'nullptr' in case of Manager not being initialized yet. */
+	* May return 'nullptr' in case of Manager not being initialized yet.
+	* Actors and UWorlds (by far the most common contexts) are resolved without UEngine::GetWorldFromContextObject */
 	static UActorSingletonManager* Get(const UObject* const WorldContext);
+	static UActorSingletonManager* Get(const UWorld* const World);
+	static UActorSingletonManager* Get(const AActor* const Actor);
 
+	/* Last UWorld resolved by UActorSingletonManager::Get and its Manager, so the lookups repeated within the same UWorld
+	*	(which is pretty much all of them) skip UWorld::GetSubsystem. Reset when said Manager goes away. Game thread only. */
+	static const UWorld* CachedWorld;
+	static UActorSingletonManager* CachedManager;
+
+	/* Gets the instance registered under given slot (see AActorSingleton::GetSlotIndex),
+	* returns 'nullptr' if there is none. */
+	AActorSingleton* GetInstanceAtSlot(const int32 Slot) const
+	{
+		return InstanceSlots.IsValidIndex(Slot) ? InstanceSlots[Slot] : nullptr;
+	}
+
+	/* Makes given Actor the instance under given slot, replacing the previous one (if any). */
+	void RegisterInstance(AActorSingleton* const Instance, const int32 Slot);
+
+	/* Evicts given Actor, does nothing if it isn't the currently registered instance. */
+	void UnregisterInstance(AActorSingleton* const Instance);
+
+	/* Every registered instance, indexed by slot of its FinalParent (see AActorSingleton::GetSlotIndex).
+	* Only grows up to the highest slot ever registered in this UWorld and destroyed instances are evicted,
+	*	so it never keeps any dead entries, and GC only has to go through one flat array of pointers. */
 	UPROPERTY()
-	TMap<TSubclassOf<AActorSingleton>, AActorSingleton*> Instances;
+	TArray<AActorSingleton*> InstanceSlots;
+
+	/* Actors that couldn't register yet (their UWorld had no UActorSingletonManager at that time), grouped by Level.
+	* They're being added from AActorSingleton::PostLoad and AActorSingleton::TryBecomeNewInstanceOrSelfDestroy,
+	*	so the cost of registering them only depends on the number of AActorSingletons, not on the number of all Actors.
+	* It's static, as the Actors usually get loaded before any UActorSingletonManager exists. */
+	static TMap<TObjectKey<ULevel>, TArray<TWeakObjectPtr<AActorSingleton>>> PendingInstances;
+};
+
+
+/* Compile time information about the root of T, declared with ACTORSINGLETON_ROOT */
+template<class T>
+struct TActorSingletonRoot
+{
+	static_assert(TIsDerivedFrom<T, AActorSingleton>::IsDerived);
+
+	/* FinalParent of T, 'void' if it isn't known at compile time */
+	using Type = typename T::FActorSingletonRoot;
+
+	/* Code that relies on T's slot being resolved at compile time can static_assert it */
+	static constexpr bool bDeclared = !std::is_void_v<Type>;
 };
 
+
+template<class T>
+/* static */ T* AActorSingleton::GetInstance(const UObject* WorldContext)
+{
+	return GetInstanceInternal<T>(WorldContext);
+}
+
+
+template<class T>
+/* static */ T* AActorSingleton::GetInstance(const UWorld* World)
+{
+	return GetInstanceInternal<T>(World);
+}
+
+
+template<class T>
+/* static */ T* AActorSingleton::GetInstance(const AActor* Actor)
+{
+	return GetInstanceInternal<T>(Actor);
+}
+
+
+template<class T, class TContext>
+/* static */ T* AActorSingleton::GetInstanceInternal(const TContext* WorldContext)
+{
+	static_assert(TIsDerivedFrom<T, AActorSingleton>::IsDerived);
+
+#if ACTORSINGLETON_LOOKUP_VALIDATION
+	check(IsValid(WorldContext))
+	const int32 Slot = AActorSingleton::GetSlotIndex<T>();
+	check(Slot != INDEX_NONE)
+
+	const UActorSingletonManager* const ActorSingletonManager = UActorSingletonManager::Get(WorldContext);
+	if (!IsValid(ActorSingletonManager))
+	{
+		ensure(!UActorSingletonManager::ShouldExistIn(WorldContext));
+		return nullptr;
+	}
+#else
+	const int32 Slot = AActorSingleton::GetSlotIndex<T>();
+	const UActorSingletonManager* const ActorSingletonManager = UActorSingletonManager::Get(WorldContext);
+	if (!ActorSingletonManager)
+	{
+		return nullptr;
+	}
+#endif //ACTORSINGLETON_LOOKUP_VALIDATION
+
+	AActorSingleton* const Instance = ActorSingletonManager->GetInstanceAtSlot(Slot);
+	FActorSingletonStats::RecordLookup(Instance != nullptr);
+	return static_cast<T*>(Instance);
+}
+
+
+template<class T>
+/* static */ T* AActorSingleton::GetInstanceAnyThread(const UActorSingletonManager* Manager)
+{
+	static_assert(TIsDerivedFrom<T, AActorSingleton>::IsDerived);
+
+	if (!Manager)
+	{
+		return nullptr;
+	}
+
+	return static_cast<T*>(Manager->GetInstanceAnyThread(T::StaticClass()));
+}
+
+
+template<class T>
+/* static */ TFuture<T*> AActorSingleton::WaitForInstance(const UObject* WorldContext)
+{
+	static_assert(TIsDerivedFrom<T, AActorSingleton>::IsDerived);
+	check(IsValid(WorldContext))
+
+	return WaitForInstance(WorldContext, T::StaticClass()).Next(
+		[](AActorSingleton* const Instance) { return static_cast<T*>(Instance); });
+}
+
+
+template<class T>
+/* static */ T* AActorSingleton::TrySpawnSingleton(
+	const UObject* WorldContext,
+	const FTransform& Transform,
+	const FActorSpawnParameters& SpawnParameters,
+	TSubclassOf<T> Class)
+{
+	static_assert(TIsDerivedFrom<T, AActorSingleton>::IsDerived);
+	return Cast<T>(AActorSingleton::TrySpawnSingletonInternal(WorldContext, Class, Transform, SpawnParameters));
+}
+
+
+template<class T>
+/* static */ int32 AActorSingleton::GetSlotIndex()
+{
+	/* Declared root never changes and slots are never reassigned, so it's resolved only once and without any CDO */
+	if constexpr (TActorSingletonRoot<T>::bDeclared)
+	{
+		static const int32 RootSlot = AActorSingleton::GetSlotIndex(TActorSingletonRoot<T>::Type::StaticClass());
+		return RootSlot;
+	}
+	else
+	{
+		static int32 Slot = INDEX_NONE;
+		static uint32 SlotSerial = 0;
+
+		if (SlotSerial != FinalParentCacheSerial)
+		{
+			AActorSingleton* const CDO = T::StaticClass()->template GetDefaultObject<AActorSingleton>();
+			Slot = AActorSingleton::GetSlotIndex(CDO->GetFinalParent());
+			SlotSerial = FinalParentCacheSerial;
+		}
+
+		return Slot;
+	}
+}
+
@@ -0,0 +1,70 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActorSingleton.h"
+
+/* Cached reference to the instance of T within chosen UWorld.
+* Resolves the instance via AActorSingleton::GetInstance<T> and keeps it
+*	until UActorSingletonManager::GetRegistryGeneration changes (any instance gets registered or evicted),
+*	so dereferencing is a single compare and a load for as long as nothing changes.
+* Meant to be stored as a member of things calling AActorSingleton::GetInstance<T> every tick.
+* Game thread only. */
+template<class T>
+class TActorSingletonHandle
+{
+	static_assert(TIsDerivedFrom<T, AActorSingleton>::IsDerived);
+
+public:
+
+	TActorSingletonHandle() = default;
+
+	explicit TActorSingletonHandle(const UObject* const WorldContext)
+	{
+		Reset(WorldContext);
+	}
+
+	/* Points this handle to another UWorld, previously resolved instance is forgotten */
+	void Reset(const UObject* const WorldContext)
+	{
+		World = WorldContext ? WorldContext->GetWorld() : nullptr;
+		CachedInstance = nullptr;
+		CachedGeneration = 0;
+	}
+
+	/* Gets the instance, may return 'nullptr' if it doesn't exist (or the UWorld is gone) */
+	T* Get() const
+	{
+		if (CachedGeneration != UActorSingletonManager::GetRegistryGeneration())
+		{
+			Resolve();
+		}
+		return CachedInstance;
+	}
+
+	T* operator->() const
+	{
+		T* const Instance = Get();
+		check(Instance)
+		return Instance;
+	}
+
+	explicit operator bool() const
+	{
+		return Get() != nullptr;
+	}
+
+private:
+
+	void Resolve() const
+	{
+		const UWorld* const ResolvedWorld = World.Get();
+		CachedInstance = ResolvedWorld ? AActorSingleton::GetInstance<T>(ResolvedWorld) : nullptr;
+		CachedGeneration = UActorSingletonManager::GetRegistryGeneration();
+	}
+
+	TWeakObjectPtr<const UWorld> World;
+	mutable T* CachedInstance = nullptr;
+	mutable uint32 CachedGeneration = 0;
+};
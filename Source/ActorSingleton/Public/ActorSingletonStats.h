@@ -0,0 +1,78 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/*================================================================================
+=	Actor Singleton Stats:
+=
+=	Always-available counters for AActorSingleton and UActorSingletonManager.
+=	Use 'stat ActorSingleton' in the console, or capture the 'ActorSingleton' CSV category
+=		(e.g. with '-csvCaptureFrames=N' or 'csvprofile start') for automated perf captures.
+=
+=	Lives in Public, as the templated AActorSingleton::GetInstance<T> has to count its calls too.
+=
+================================================================================*/
+
+DECLARE_STATS_GROUP(TEXT("ActorSingleton"), STATGROUP_ActorSingleton, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("GetInstance Calls"), STAT_ActorSingleton_GetInstanceCalls, STATGROUP_ActorSingleton, ACTORSINGLETON_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("GetInstance Hits"), STAT_ActorSingleton_GetInstanceHits, STATGROUP_ActorSingleton, ACTORSINGLETON_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("GetInstance Misses"), STAT_ActorSingleton_GetInstanceMisses, STATGROUP_ActorSingleton, ACTORSINGLETON_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Duplicates Rejected"), STAT_ActorSingleton_DuplicatesRejected, STATGROUP_ActorSingleton, ACTORSINGLETON_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Registered Instances"), STAT_ActorSingleton_RegisteredInstances, STATGROUP_ActorSingleton, ACTORSINGLETON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Duplicate Resolution"), STAT_ActorSingleton_DuplicateResolution, STATGROUP_ActorSingleton, ACTORSINGLETON_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ACTORSINGLETON_API, ActorSingleton);
+
+
+/* Helpers for the counters that are updated from more than one place */
+struct ACTORSINGLETON_API FActorSingletonStats
+{
+	/* Counts a single call to any version of AActorSingleton::GetInstance
+	* CSV stats are only accumulated here and recorded once per frame (see FActorSingletonStats::FlushLookups),
+	*	as recording them on every call would cost more than the lookup itself. */
+	static FORCEINLINE void RecordLookup(const bool bHit)
+	{
+		INC_DWORD_STAT(STAT_ActorSingleton_GetInstanceCalls);
+
+		if (bHit)
+		{
+			INC_DWORD_STAT(STAT_ActorSingleton_GetInstanceHits);
+#if CSV_PROFILER
+			++LookupHitsThisFrame;
+#endif //CSV_PROFILER
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_ActorSingleton_GetInstanceMisses);
+#if CSV_PROFILER
+			++LookupMissesThisFrame;
+#endif //CSV_PROFILER
+		}
+	}
+
+#if CSV_PROFILER
+	/* Records lookups counted since the last call into the CSV profile and resets the counters.
+	* Called at the end of every frame by UActorSingletonManager, safe to call more than once per frame. */
+	static void FlushLookups();
+#endif //CSV_PROFILER
+
+	/* Counts a single duplicate that is about to be destroyed */
+	static FORCEINLINE void RecordDuplicateRejected()
+	{
+		INC_DWORD_STAT(STAT_ActorSingleton_DuplicatesRejected);
+		CSV_CUSTOM_STAT(ActorSingleton, DuplicatesRejected, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+private:
+
+#if CSV_PROFILER
+	/* Plain counters, as lookups are only ever counted on the game thread */
+	static int32 LookupHitsThisFrame;
+	static int32 LookupMissesThisFrame;
+#endif //CSV_PROFILER
+};
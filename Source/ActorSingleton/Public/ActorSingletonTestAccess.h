@@ -0,0 +1,81 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActorSingleton.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/* The only way for automation tests (see ActorSingletonTests module) to reach the internals of AActorSingleton and UActorSingletonManager.
+* Exposes only what the tests need, everything else stays private. Compiled out together with the automation tests.
+* Nothing but the tests is supposed to include it. */
+struct FActorSingletonTestAccess
+{
+	/* UActorSingletonManager::Get overloads */
+	static UActorSingletonManager* GetManager(const UObject* const WorldContext)
+	{
+		return UActorSingletonManager::Get(WorldContext);
+	}
+	static UActorSingletonManager* GetManager(const UWorld* const World)
+	{
+		return UActorSingletonManager::Get(World);
+	}
+	static UActorSingletonManager* GetManager(const AActor* const Actor)
+	{
+		return UActorSingletonManager::Get(Actor);
+	}
+
+	/* Registry of given Manager, indexed by slot (see AActorSingleton::GetSlotIndex) */
+	static const TArray<AActorSingleton*>& GetInstanceSlots(const UActorSingletonManager* const Manager)
+	{
+		return Manager->InstanceSlots;
+	}
+
+	static AActorSingleton* GetInstanceAtSlot(const UActorSingletonManager* const Manager, const int32 Slot)
+	{
+		return Manager->GetInstanceAtSlot(Slot);
+	}
+
+	static TSubclassOf<AActorSingleton> GetFinalParent(AActorSingleton* const Actor)
+	{
+		return Actor->GetFinalParent();
+	}
+
+	static int32 GetSlotIndex(const TSubclassOf<AActorSingleton> FinalParent)
+	{
+		return AActorSingleton::GetSlotIndex(FinalParent);
+	}
+
+	/* Same handlers that Level streaming goes through, see UActorSingletonManager::HandlePreLevelRemovedFromWorld */
+	static void RemoveLevel(UActorSingletonManager* const Manager, ULevel* const Level)
+	{
+		Manager->HandlePreLevelRemovedFromWorld(Level, Manager->GetWorld());
+	}
+	static void AddLevel(UActorSingletonManager* const Manager, ULevel* const Level)
+	{
+		Manager->HandleLevelAddedToWorld(Level, Manager->GetWorld());
+	}
+
+	/* Sends the registered instance through the whole duplicate resolution again, as if it has never been registered.
+	* It finds itself in the registry, so nothing changes. */
+	static void ResolveRegisteredInstance(AActorSingleton* const Instance)
+	{
+		const int32 RegisteredSlot = Instance->RegisteredSlot;
+		Instance->RegisteredSlot = INDEX_NONE;
+		Instance->TryBecomeNewInstanceOrSelfDestroy();
+		Instance->RegisteredSlot = RegisteredSlot;
+	}
+
+	static int32 GetRetiredSnapshotCount(const UActorSingletonManager* const Manager)
+	{
+		return Manager->RetiredSnapshots.Num();
+	}
+
+	static void FreeRetiredSnapshots(UActorSingletonManager* const Manager)
+	{
+		Manager->FreeRetiredSnapshots(false);
+	}
+};
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,48 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/CancellableAsyncAction.h"
+#include "ActorSingleton.h"
+#include "WaitForActorSingletonAction.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FWaitForActorSingletonOutputPin, AActorSingleton*, Instance);
+
+/* Blueprint version of AActorSingleton::WaitForInstance<T>
+* Completes once an instance of chosen class gets registered in current UWorld (or right away, if there already is one),
+*	so BeginPlay doesn't have to retry GetInstance on timers when it runs before the Actor Singleton it depends on.
+* Instance of a sibling class (sharing the same FinalParent) doesn't count: while it's registered, the node keeps waiting,
+*	until said sibling is gone and an instance of chosen class takes its place, or until the UWorld goes away (OnAbandoned). */
+UCLASS()
+class ACTORSINGLETON_API UWaitForActorSingletonAction : public UCancellableAsyncAction
+{
+	GENERATED_BODY()
+
+public:
+
+	/* Waits until an instance of chosen class (or its subclass) is registered in current UWorld.
+	* Keeps waiting while an instance of a sibling class (sharing the same FinalParent) holds the slot. */
+	UFUNCTION(BlueprintCallable,
+		meta = (DisplayName = "Wait For Actor Singleton", BlueprintInternalUseOnly = "true", WorldContext = "WorldContext"))
+	static UWaitForActorSingletonAction* WaitForActorSingleton(const UObject* const WorldContext, TSubclassOf<AActorSingleton> Class);
+
+	/* Instance is registered */
+	UPROPERTY(BlueprintAssignable)
+	FWaitForActorSingletonOutputPin OnRegistered;
+
+	/* UWorld went away before any instance got registered */
+	UPROPERTY(BlueprintAssignable)
+	FWaitForActorSingletonOutputPin OnAbandoned;
+
+	//~ Begin UBlueprintAsyncActionBase Interface
+	virtual void Activate() override;
+	//~ End UBlueprintAsyncActionBase Interface
+
+private:
+
+	void HandleInstance(AActorSingleton* const Instance);
+
+	TWeakObjectPtr<const UObject> WorldContext;
+	TSubclassOf<AActorSingleton> Class;
+};
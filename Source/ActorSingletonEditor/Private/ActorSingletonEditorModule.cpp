@@ -0,0 +1,198 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#include "ActorSingletonEditorModule.h"
+#include "ActorSingleton.h"
+#include "Editor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/MessageDialog.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+#include "Subsystems/EditorActorSubsystem.h"
+#include "TimerManager.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_MODULE(FActorSingletonEditorModule, ActorSingletonEditor)
+
+static TAutoConsoleVariable<int32> CVarEditorDuplicateGC(
+	TEXT("ActorSingleton.EditorDuplicateGC"),
+	0,
+	TEXT("What to do with Garbage Collection after a duplicate gets deleted from an Editor World:\n")
+	TEXT("0: nothing, deleted duplicates are collected whenever the Editor collects garbage on its own (default)\n")
+	TEXT("1: ask for Garbage Collection without the full purge\n")
+	TEXT("2: ask for the full purge (may stall the Editor for a long time on large maps)\n")
+	TEXT("Either way the Engine runs it once at the end of the frame, no matter how many duplicates got deleted."),
+	ECVF_Default);
+
+
+/* virtual override */ void FActorSingletonEditorModule::StartupModule()
+{
+	FActorSingletonEditorHooks::OnEditorDuplicateFound.BindRaw(this, &FActorSingletonEditorModule::HandleEditorDuplicate);
+
+	/* GEditor does not exist yet when this module starts up, so we must wait for the Engine */
+	PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FActorSingletonEditorModule::HandlePostEngineInit);
+}
+
+
+/* virtual override */ void FActorSingletonEditorModule::ShutdownModule()
+{
+	FActorSingletonEditorHooks::OnEditorDuplicateFound.Unbind();
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(FlushHandle);
+
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+}
+
+
+void FActorSingletonEditorModule::HandlePostEngineInit()
+{
+	/* Blueprint can override IsFinalParent, so every recompile may change the result */
+	if (GEditor)
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddLambda(
+			[]()->void
+			{
+				FActorSingletonEditorHooks::InvalidateFinalParentCache();
+			}
+		);
+	}
+}
+
+
+void FActorSingletonEditorModule::HandleEditorDuplicate(AActorSingleton* const Duplicate)
+{
+	/* FIXME: if user's Actor does something after being placed (outside of the transaction), we won't be able to revert it */
+
+	/* Construction script of the same duplicate may rerun before the flush */
+	if (Duplicates.ContainsByPredicate([Duplicate](const FEditorDuplicate& Queued) { return Queued.Actor == Duplicate; }))
+	{
+		return;
+	}
+
+	/* Only the first duplicate of the batch schedules the flush */
+	if (Duplicates.IsEmpty())
+	{
+		FlushHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+			[this](float)->bool
+			{
+				FlushDuplicates();
+				return false;
+			}
+		));
+	}
+
+	/* Message is taken right away, as the duplicate may already be gone when the dialog shows up */
+	FEditorDuplicate& Queued = Duplicates.AddDefaulted_GetRef();
+	Queued.Actor = Duplicate;
+	Queued.World = Duplicate->GetWorld();
+	Queued.Label = Duplicate->GetActorLabel();
+	Queued.MessageTitle = Duplicate->GetMessageTitle();
+	Queued.MessageBody = Duplicate->GetMessageBody();
+
+	/* Placement that created the duplicate (e.g. "Paste" or "Place Actor") is usually still being recorded.
+	* Destroying it within the very same transaction means that the placement and the destruction get undone (and redone) together,
+	*	so the undo can never resurrect the duplicate, and we don't have to modify the Level (nor dirty it) ourselves. */
+	if (GUndo)
+	{
+		DestroyDuplicateInTransaction(Duplicate);
+	}
+}
+
+
+void FActorSingletonEditorModule::DestroyDuplicateInTransaction(AActorSingleton* const Duplicate)
+{
+	/* Actors of World Partition Levels live in their own packages (One File Per Actor),
+	*	and a brand new package has nothing worth saving once its Actor is gone. */
+	UPackage* const ExternalPackage = Duplicate->GetExternalPackage();
+	const bool bNewExternalPackage = ExternalPackage && !FPackageName::DoesPackageExist(ExternalPackage->GetName());
+
+	Duplicate->GetWorld()->EditorDestroyActor(Duplicate, false);
+
+	if (bNewExternalPackage)
+	{
+		ExternalPackage->SetDirtyFlag(false);
+	}
+}
+
+
+void FActorSingletonEditorModule::FlushDuplicates()
+{
+	FlushHandle.Reset();
+
+	TArray<FEditorDuplicate> Queued = MoveTemp(Duplicates);
+	if (Queued.IsEmpty() || !GEditor)
+	{
+		return;
+	}
+
+	/* Show Dialogue Message, one for the whole batch */
+	const FText MessageTitle = Queued[0].MessageTitle;
+	FText MessageBody;
+	if (Queued.Num() == 1)
+	{
+		MessageBody = Queued[0].MessageBody;
+	}
+	else
+	{
+		constexpr int32 MaxListedDuplicates = 10;
+		FString DuplicateNames;
+		for (int32 i = 0; i < Queued.Num() && i < MaxListedDuplicates; ++i)
+		{
+			DuplicateNames += FString::Printf(TEXT("\n%s"), *Queued[i].Label);
+		}
+		if (Queued.Num() > MaxListedDuplicates)
+		{
+			DuplicateNames += FString::Printf(TEXT("\n...and %d more"), Queued.Num() - MaxListedDuplicates);
+		}
+
+		MessageBody = FText::FromString(FString::Printf(
+			TEXT("%d duplicate instances were found and will be destroyed!")
+			TEXT("\nThere is already one instance of each of them in current UWorld!")
+			TEXT("\n(check log for more detailed error)\n%s"),
+			Queued.Num(), *DuplicateNames));
+	}
+	FMessageDialog::Debugf(MessageBody, MessageTitle);
+
+	/* Duplicates created outside of any transaction (e.g. by some editor tool) are still here, grouped by their UWorld */
+	TMap<UWorld*, TArray<AActor*>> DuplicatesByWorld;
+	for (const FEditorDuplicate& Duplicate : Queued)
+	{
+		/* User might have already deleted it (or undone the placement) before this tick */
+		AActorSingleton* const Actor = Duplicate.Actor.Get();
+		UWorld* const World = Duplicate.World.Get();
+		if (IsValid(Actor) && !Actor->IsActorBeingDestroyed() && World)
+		{
+			DuplicatesByWorld.FindOrAdd(World).Add(Actor);
+		}
+	}
+
+	UEditorActorSubsystem* const EditorActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
+	check(EditorActorSubsystem)
+
+	/* Delete all of them via UEditorActorSubsystem, with a single selection change (per UWorld, which is usually just one) */
+	for (const TPair<UWorld*, TArray<AActor*>>& Pair : DuplicatesByWorld)
+	{
+		EditorActorSubsystem->SetSelectedLevelActors(Pair.Value);
+		EditorActorSubsystem->DeleteSelectedActors(Pair.Key);
+	}
+
+	/* UEngine::ForceGarbageCollection only sets a flag for the next tick, and now it's also requested once per batch */
+	if (const int32 GCMode = CVarEditorDuplicateGC.GetValueOnGameThread(); GCMode > 0)
+	{
+		GEngine->ForceGarbageCollection(GCMode >= 2);
+	}
+
+	/* Garbage Actors still seem to be selected in the Details Panel despite already being destroyed.
+	* Neither 'UEditorActorSubsystem::DeleteSelectedActors' nor 'UWorld::EditorDestroyActor' handles this by itself,
+	* so we are clearing the Actor selection on the very next tick which fixes this issue. */
+	GEditor->GetTimerManager()->SetTimerForNextTick(
+		FTimerDelegate::CreateWeakLambda(EditorActorSubsystem, [EditorActorSubsystem]()->void
+			{
+				EditorActorSubsystem->SelectNothing();
+			}
+		)
+	);
+}
@@ -0,0 +1,48 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Modules/ModuleInterface.h"
+
+class AActorSingleton;
+
+/* Editor side of ActorSingleton plugin, hooked into the runtime module via FActorSingletonEditorHooks
+* Takes care of duplicates placed into the Level Viewport (which can't be simply destroyed),
+*	and of Blueprint recompiles that may change the result of AActorSingleton::IsFinalParent */
+class FActorSingletonEditorModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+private:
+	void HandlePostEngineInit();
+
+	/* Queues a duplicate placed in the Editor World, to be deleted in FActorSingletonEditorModule::FlushDuplicates on the next tick.
+	* Pasting (or alt-dragging) a selection creates many duplicates at once,
+	*	and we want them to end up with one dialog, one delete and one selection update, not one of each per Actor. */
+	void HandleEditorDuplicate(AActorSingleton* const Duplicate);
+
+	/* Destroys given duplicate within the currently recorded transaction, without modifying its Level */
+	void DestroyDuplicateInTransaction(AActorSingleton* const Duplicate);
+
+	/* Shows a single dialog about every queued duplicate and deletes all of them at once */
+	void FlushDuplicates();
+
+	struct FEditorDuplicate
+	{
+		TWeakObjectPtr<AActorSingleton> Actor;
+		TWeakObjectPtr<UWorld> World;
+		FString Label;
+		FText MessageTitle;
+		FText MessageBody;
+	};
+
+	TArray<FEditorDuplicate> Duplicates;
+
+	FTSTicker::FDelegateHandle FlushHandle;
+	FDelegateHandle PostEngineInitHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+};
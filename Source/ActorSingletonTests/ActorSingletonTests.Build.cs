@@ -0,0 +1,20 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+using UnrealBuildTool;
+
+public class ActorSingletonTests : ModuleRules
+{
+	public ActorSingletonTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"Json",
+			"ActorSingleton",
+		});
+	}
+}
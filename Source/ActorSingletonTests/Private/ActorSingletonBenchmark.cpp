@@ -0,0 +1,812 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#include "ActorSingletonBenchmark.h"
+#include "ActorSingleton.h"
+#include "ActorSingletonBenchmarkActors.h"
+#include "ActorSingletonBenchmarkRegistries.h"
+#include "ActorSingletonTestAccess.h"
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+static constexpr uint32 BenchmarkTestFlags =
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter;
+
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonLookupBenchmark, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.Benchmark.Lookup", BenchmarkTestFlags)
+bool FActorSingletonLookupBenchmark::RunTest(const FString& Parameters)
+{
+	FActorSingletonBenchmark::RunLookup(*this);
+	return !HasAnyErrors();
+}
+
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonTypedLookupBenchmark, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.Benchmark.TypedLookup", BenchmarkTestFlags)
+bool FActorSingletonTypedLookupBenchmark::RunTest(const FString& Parameters)
+{
+	FActorSingletonBenchmark::RunTypedLookup(*this);
+	return !HasAnyErrors();
+}
+
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonAnyThreadStressBenchmark, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.Benchmark.AnyThreadStress", BenchmarkTestFlags)
+bool FActorSingletonAnyThreadStressBenchmark::RunTest(const FString& Parameters)
+{
+	FActorSingletonBenchmark::RunAnyThreadStress(*this);
+	return !HasAnyErrors();
+}
+
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonWorldResolutionBenchmark, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.Benchmark.WorldResolution", BenchmarkTestFlags)
+bool FActorSingletonWorldResolutionBenchmark::RunTest(const FString& Parameters)
+{
+	FActorSingletonBenchmark::RunWorldResolution(*this);
+	return !HasAnyErrors();
+}
+
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonSpawnStormBenchmark, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.Benchmark.SpawnStorm", BenchmarkTestFlags)
+bool FActorSingletonSpawnStormBenchmark::RunTest(const FString& Parameters)
+{
+	FActorSingletonBenchmark::RunSpawnStorm(*this);
+	return !HasAnyErrors();
+}
+
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonRejectedSpawnCostBenchmark, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.Benchmark.RejectedSpawnCost", BenchmarkTestFlags)
+bool FActorSingletonRejectedSpawnCostBenchmark::RunTest(const FString& Parameters)
+{
+	FActorSingletonBenchmark::RunRejectedSpawnCost(*this);
+	return !HasAnyErrors();
+}
+
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonConstructionRerunBenchmark, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.Benchmark.ConstructionRerun", BenchmarkTestFlags)
+bool FActorSingletonConstructionRerunBenchmark::RunTest(const FString& Parameters)
+{
+	FActorSingletonBenchmark::RunConstructionRerun(*this);
+	return !HasAnyErrors();
+}
+
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonWorldInitBenchmark, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.Benchmark.WorldInit", BenchmarkTestFlags)
+bool FActorSingletonWorldInitBenchmark::RunTest(const FString& Parameters)
+{
+	FActorSingletonBenchmark::RunWorldInit(*this);
+	return !HasAnyErrors();
+}
+
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonGarbageCollectionBenchmark, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.Benchmark.GarbageCollection", BenchmarkTestFlags)
+bool FActorSingletonGarbageCollectionBenchmark::RunTest(const FString& Parameters)
+{
+	FActorSingletonBenchmark::RunGarbageCollection(*this);
+	return !HasAnyErrors();
+}
+
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonRegistryLayoutBenchmark, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.Benchmark.RegistryLayout", BenchmarkTestFlags)
+bool FActorSingletonRegistryLayoutBenchmark::RunTest(const FString& Parameters)
+{
+	FActorSingletonBenchmark::RunRegistryLayout(*this);
+	return !HasAnyErrors();
+}
+
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonStreamingBenchmark, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.Benchmark.Streaming", BenchmarkTestFlags)
+bool FActorSingletonStreamingBenchmark::RunTest(const FString& Parameters)
+{
+	FActorSingletonBenchmark::RunStreaming(*this);
+	return !HasAnyErrors();
+}
+
+
+/* static */ double FActorSingletonBenchmark::MeasureGarbageCollection(const int32 Collections)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < Collections; ++i)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+	}
+	return FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles) * 1e3 / Collections;
+}
+
+
+/* static */ TArray<UClass*> FActorSingletonBenchmark::GetBenchmarkClasses()
+{
+	TArray<UClass*> Classes;
+	GetDerivedClasses(AActorSingletonBenchmarkActor::StaticClass(), Classes, false);
+	Classes.RemoveAll([](const UClass* const Class) { return Class->HasAnyClassFlags(CLASS_Abstract | CLASS_NewerVersionExists); });
+	Classes.Sort([](const UClass& A, const UClass& B) { return A.GetFName().LexicalLess(B.GetFName()); });
+	return Classes;
+}
+
+
+/* static */ TArray<AActorSingleton*> FActorSingletonBenchmark::SpawnSingletons(UWorld* const World, const int32 Count)
+{
+	const TArray<UClass*> Classes = GetBenchmarkClasses();
+	check(Count <= Classes.Num())
+
+	TArray<AActorSingleton*> Instances;
+	Instances.Reserve(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Instances.Add(World->SpawnActor<AActorSingleton>(Classes[i]));
+	}
+	return Instances;
+}
+
+
+/* static */ int32 FActorSingletonBenchmark::CountRegistered(const UActorSingletonManager* const Manager)
+{
+	int32 Count = 0;
+	for (const AActorSingleton* const Instance : FActorSingletonTestAccess::GetInstanceSlots(Manager))
+	{
+		Count += Instance ? 1 : 0;
+	}
+	return Count;
+}
+
+
+/* static */ TSharedRef<FJsonObject> FActorSingletonBenchmark::MakeReport(const FString& Name)
+{
+	const TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("benchmark"), Name);
+	Report->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+
+	/* Results are only comparable within the same configuration, see 'Build configuration' in README */
+	Report->SetStringField(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+	Report->SetStringField(TEXT("buildConfiguration"), LexToString(FApp::GetBuildConfiguration()));
+	Report->SetBoolField(TEXT("lookupValidation"), ACTORSINGLETON_LOOKUP_VALIDATION);
+	Report->SetBoolField(TEXT("withLogging"), ACTORSINGLETON_WITH_LOGGING);
+	return Report;
+}
+
+
+/* static */ void FActorSingletonBenchmark::SaveReport(FAutomationTestBase& Test, const TSharedRef<FJsonObject>& Report)
+{
+	FString Json;
+	const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+	FJsonSerializer::Serialize(Report, Writer);
+
+	const FString FilePath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("ActorSingleton"),
+		FString::Printf(TEXT("Benchmark-%s-%s.json"), *Report->GetStringField(TEXT("benchmark")), *FDateTime::Now().ToString()));
+	FFileHelper::SaveStringToFile(Json, *FilePath);
+
+	Test.AddInfo(FString::Printf(TEXT("Results saved to '%s':\n%s"), *FilePath, *Json));
+}
+
+
+/* GetInstance (Blueprint version) vs GetInstance<T> vs GetInstanceAnyThread<T>, on the same registered instance */
+/* static */ void FActorSingletonBenchmark::RunLookup(FAutomationTestBase& Test)
+{
+	using ABenchmarkActor = AActorSingletonBenchmarkActor000;
+	constexpr int32 Iterations = 1000000;
+
+	FActorSingletonScopedWorld ScopedWorld(Test, TEXT("ActorSingletonBenchmark_Lookup"));
+	if (!ScopedWorld.HasManager())
+	{
+		return;
+	}
+
+	UWorld* const World = ScopedWorld.World;
+	ABenchmarkActor* const Instance = World->SpawnActor<ABenchmarkActor>();
+	Test.TestTrue(TEXT("GetInstance finds the instance"), AActorSingleton::GetInstance(World, ABenchmarkActor::StaticClass()) == Instance);
+	Test.TestTrue(TEXT("GetInstance<T> finds the instance"), AActorSingleton::GetInstance<ABenchmarkActor>(World) == Instance);
+	const UActorSingletonManager* const Manager = UActorSingletonManager::GetForAnyThread(World);
+	Test.TestTrue(TEXT("GetInstanceAnyThread<T> finds the instance"), AActorSingleton::GetInstanceAnyThread<ABenchmarkActor>(Manager) == Instance);
+
+	const TSharedRef<FJsonObject> Report = MakeReport(TEXT("Lookup"));
+	Report->SetNumberField(TEXT("iterations"), Iterations);
+
+	/* Blueprint version, resolves the CDO and FinalParent on every call */
+	Report->SetNumberField(TEXT("getInstanceNs"), MeasureNanoseconds(Iterations,
+		[World]() { return AActorSingleton::GetInstance(World, ABenchmarkActor::StaticClass()); }));
+
+	Report->SetNumberField(TEXT("getInstanceTypedNs"), MeasureNanoseconds(Iterations,
+		[World]() { return AActorSingleton::GetInstance<ABenchmarkActor>(World); }));
+
+	Report->SetNumberField(TEXT("getInstanceAnyThreadNs"), MeasureNanoseconds(Iterations,
+		[Manager]() { return AActorSingleton::GetInstanceAnyThread<ABenchmarkActor>(Manager); }));
+
+	SaveReport(Test, Report);
+}
+
+
+/* GetInstance<T> (slot cached per type, or resolved at compile time for a declared root) vs the generic path it replaced:
+*	UWorld from the context, UWorld::GetSubsystem, CDO and FinalParent, then two probes of a map keyed by FinalParent */
+/* static */ void FActorSingletonBenchmark::RunTypedLookup(FAutomationTestBase& Test)
+{
+	using ABenchmarkActor = AActorSingletonBenchmarkActor000;
+	constexpr int32 Iterations = 1000000;
+
+	FActorSingletonScopedWorld ScopedWorld(Test, TEXT("ActorSingletonBenchmark_TypedLookup"));
+	if (!ScopedWorld.HasManager())
+	{
+		return;
+	}
+
+	UWorld* const World = ScopedWorld.World;
+	ABenchmarkActor* const Instance = World->SpawnActor<ABenchmarkActor>();
+	AActorSingletonBenchmarkRoot* const RootInstance = World->SpawnActor<AActorSingletonBenchmarkRoot>();
+
+	TMap<TSubclassOf<AActorSingleton>, AActorSingleton*> MapInstances;
+	MapInstances.Add(ABenchmarkActor::StaticClass(), Instance);
+
+	const auto GetInstanceThroughMap = [World, &MapInstances]() -> AActorSingleton*
+	{
+		const UWorld* const ContextWorld = GEngine->GetWorldFromContextObject(World, EGetWorldErrorMode::Assert);
+		if (!ContextWorld->GetSubsystem<UActorSingletonManager>())
+		{
+			return nullptr;
+		}
+
+		const TSubclassOf<AActorSingleton> FinalParent = FActorSingletonTestAccess::GetFinalParent(ABenchmarkActor::StaticClass()->GetDefaultObject<ABenchmarkActor>());
+		return MapInstances.Contains(FinalParent) ? MapInstances[FinalParent] : nullptr;
+	};
+
+	Test.TestTrue(TEXT("GetInstance<T> finds the instance"), AActorSingleton::GetInstance<ABenchmarkActor>(World) == Instance);
+	Test.TestTrue(TEXT("GetInstance<T> finds the declared root"), AActorSingleton::GetInstance<AActorSingletonBenchmarkRoot>(World) == RootInstance);
+	Test.TestTrue(TEXT("Map path finds the instance"), GetInstanceThroughMap() == Instance);
+
+	const TSharedRef<FJsonObject> Report = MakeReport(TEXT("TypedLookup"));
+	Report->SetNumberField(TEXT("iterations"), Iterations);
+
+	Report->SetNumberField(TEXT("getInstanceTypedNs"), MeasureNanoseconds(Iterations,
+		[World]() { return AActorSingleton::GetInstance<ABenchmarkActor>(World); }));
+
+	Report->SetNumberField(TEXT("getInstanceDeclaredRootNs"), MeasureNanoseconds(Iterations,
+		[World]() { return AActorSingleton::GetInstance<AActorSingletonBenchmarkRoot>(World); }));
+
+	/* FinalParent is cached per UClass now, so this is a lower bound of what the generic path used to cost */
+	Report->SetNumberField(TEXT("getInstanceThroughMapNs"), MeasureNanoseconds(Iterations, GetInstanceThroughMap));
+
+	SaveReport(Test, Report);
+}
+
+
+/* Reader threads hammering GetInstanceAnyThread while the game thread keeps evicting and registering every singleton.
+* Readers may see an instance or 'nullptr' (depending on when they look), but never an instance of another class,
+*	and the snapshots they kept alive must all get freed once they're done. */
+/* static */ void FActorSingletonBenchmark::RunAnyThreadStress(FAutomationTestBase& Test)
+{
+	constexpr int32 Cycles = 5000;
+	constexpr int32 SingletonCount = 16;
+	const int32 ReaderCount = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads() - 1, 2, 8);
+
+	FActorSingletonScopedWorld ScopedWorld(Test, TEXT("ActorSingletonBenchmark_AnyThreadStress"));
+	if (!ScopedWorld.HasManager())
+	{
+		return;
+	}
+
+	const TArray<AActorSingleton*> Instances = SpawnSingletons(ScopedWorld.World, SingletonCount);
+	TArray<const UClass*> Classes;
+	for (const AActorSingleton* const Instance : Instances)
+	{
+		Classes.Add(Instance->GetClass());
+	}
+
+	/* Taken on the game thread, just like every user of GetInstanceAnyThread has to */
+	const UActorSingletonManager* const Manager = UActorSingletonManager::GetForAnyThread(ScopedWorld.World);
+
+	std::atomic<bool> bStop { false };
+	std::atomic<int64> Reads { 0 };
+	std::atomic<int64> Hits { 0 };
+	std::atomic<int32> WrongReads { 0 };
+
+	TArray<TFuture<void>> Readers;
+	for (int32 ReaderIndex = 0; ReaderIndex < ReaderCount; ++ReaderIndex)
+	{
+		Readers.Add(Async(EAsyncExecution::Thread, [&, ReaderIndex]()
+			{
+				int64 LocalReads = 0;
+				int64 LocalHits = 0;
+				int32 LocalWrongReads = 0;
+				for (int32 Next = ReaderIndex; !bStop.load(std::memory_order_relaxed); Next = (Next + 1) % Classes.Num())
+				{
+					const AActorSingleton* const Found = Manager->GetInstanceAnyThread(Classes[Next]);
+					LocalWrongReads += (Found && Found != Instances[Next]) ? 1 : 0;
+					LocalHits += Found ? 1 : 0;
+					++LocalReads;
+				}
+
+				Reads += LocalReads;
+				Hits += LocalHits;
+				WrongReads += LocalWrongReads;
+			}));
+	}
+
+	int32 MaxRetiredSnapshots = 0;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < Cycles; ++i)
+	{
+		FActorSingletonTestAccess::RemoveLevel(ScopedWorld.Manager, ScopedWorld.Level);
+		MaxRetiredSnapshots = FMath::Max(MaxRetiredSnapshots, FActorSingletonTestAccess::GetRetiredSnapshotCount(ScopedWorld.Manager));
+		FActorSingletonTestAccess::AddLevel(ScopedWorld.Manager, ScopedWorld.Level);
+		MaxRetiredSnapshots = FMath::Max(MaxRetiredSnapshots, FActorSingletonTestAccess::GetRetiredSnapshotCount(ScopedWorld.Manager));
+	}
+	const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	bStop = true;
+	for (TFuture<void>& Reader : Readers)
+	{
+		Reader.Wait();
+	}
+	FActorSingletonTestAccess::FreeRetiredSnapshots(ScopedWorld.Manager);
+
+	Test.TestEqual(TEXT("Readers never see an instance of another class"), WrongReads.load(), 0);
+	Test.TestTrue(TEXT("Readers keep making progress while the registry changes"), Hits.load() > 0);
+	Test.TestEqual(TEXT("Every instance is registered after the last cycle"), CountRegistered(ScopedWorld.Manager), SingletonCount);
+	Test.TestEqual(TEXT("Every retired snapshot gets freed once the readers are done"), FActorSingletonTestAccess::GetRetiredSnapshotCount(ScopedWorld.Manager), 0);
+
+	const TSharedRef<FJsonObject> Report = MakeReport(TEXT("AnyThreadStress"));
+	Report->SetNumberField(TEXT("readerThreads"), ReaderCount);
+	Report->SetNumberField(TEXT("singletons"), SingletonCount);
+	Report->SetNumberField(TEXT("publishes"), Cycles * 2);
+	Report->SetNumberField(TEXT("usPerPublish"), Seconds * 1e6 / (Cycles * 2));
+	Report->SetNumberField(TEXT("readsPerSecond"), Reads.load() / Seconds);
+	Report->SetNumberField(TEXT("hitRatio"), Reads.load() > 0 ? double(Hits.load()) / Reads.load() : 0.0);
+	Report->SetNumberField(TEXT("maxRetiredSnapshots"), MaxRetiredSnapshots);
+	SaveReport(Test, Report);
+}
+
+
+/* Resolving UActorSingletonManager from every kind of context: Actor, UWorld and any other UObject (a component here),
+*	vs UEngine::GetWorldFromContextObject followed by UWorld::GetSubsystem, which every lookup used to go through.
+* Alternating between two UWorlds defeats the cache of the last resolved Manager, so it shows the cost of a miss too. */
+/* static */ void FActorSingletonBenchmark::RunWorldResolution(FAutomationTestBase& Test)
+{
+	using ABenchmarkActor = AActorSingletonBenchmarkComponentsActor;
+	constexpr int32 Iterations = 1000000;
+
+	FActorSingletonScopedWorld ScopedWorld(Test, TEXT("ActorSingletonBenchmark_WorldResolution"));
+	FActorSingletonScopedWorld OtherScopedWorld(Test, TEXT("ActorSingletonBenchmark_WorldResolutionOther"));
+	if (!ScopedWorld.HasManager() || !OtherScopedWorld.HasManager())
+	{
+		return;
+	}
+
+	const UWorld* const World = ScopedWorld.World;
+	const UWorld* const OtherWorld = OtherScopedWorld.World;
+	const ABenchmarkActor* const Instance = ScopedWorld.World->SpawnActor<ABenchmarkActor>();
+	const UObject* const ActorContext = Instance;
+	const UObject* const ComponentContext = Instance->GetRootComponent();
+
+	const auto GetThroughEngine = [ActorContext]()
+	{
+		return GEngine->GetWorldFromContextObject(ActorContext, EGetWorldErrorMode::Assert)->GetSubsystem<UActorSingletonManager>();
+	};
+
+	UActorSingletonManager* const Manager = ScopedWorld.Manager;
+	Test.TestTrue(TEXT("Every context resolves the same Manager"),
+		GetThroughEngine() == Manager
+		&& FActorSingletonTestAccess::GetManager(ActorContext) == Manager
+		&& FActorSingletonTestAccess::GetManager(Instance) == Manager
+		&& FActorSingletonTestAccess::GetManager(World) == Manager
+		&& FActorSingletonTestAccess::GetManager(ComponentContext) == Manager);
+	Test.TestTrue(TEXT("GetInstance<T> resolves from any context"),
+		AActorSingleton::GetInstance<ABenchmarkActor>(Instance) == Instance
+		&& AActorSingleton::GetInstance<ABenchmarkActor>(ComponentContext) == Instance);
+
+	const TSharedRef<FJsonObject> Report = MakeReport(TEXT("WorldResolution"));
+	Report->SetNumberField(TEXT("iterations"), Iterations);
+
+	Report->SetNumberField(TEXT("getWorldFromContextObjectNs"), MeasureNanoseconds(Iterations, GetThroughEngine));
+	Report->SetNumberField(TEXT("managerFromObjectNs"), MeasureNanoseconds(Iterations,
+		[ActorContext]() { return FActorSingletonTestAccess::GetManager(ActorContext); }));
+	Report->SetNumberField(TEXT("managerFromActorNs"), MeasureNanoseconds(Iterations,
+		[Instance]() { return FActorSingletonTestAccess::GetManager(Instance); }));
+	Report->SetNumberField(TEXT("managerFromWorldNs"), MeasureNanoseconds(Iterations,
+		[World]() { return FActorSingletonTestAccess::GetManager(World); }));
+	Report->SetNumberField(TEXT("managerFromComponentNs"), MeasureNanoseconds(Iterations,
+		[ComponentContext]() { return FActorSingletonTestAccess::GetManager(ComponentContext); }));
+
+	int32 Next = 0;
+	Report->SetNumberField(TEXT("managerAlternatingWorldsNs"), MeasureNanoseconds(Iterations,
+		[World, OtherWorld, &Next]() { return FActorSingletonTestAccess::GetManager(++Next % 2 ? World : OtherWorld); }));
+
+	Report->SetNumberField(TEXT("getInstanceTypedFromActorNs"), MeasureNanoseconds(Iterations,
+		[Instance]() { return AActorSingleton::GetInstance<ABenchmarkActor>(Instance); }));
+	Report->SetNumberField(TEXT("getInstanceTypedFromComponentNs"), MeasureNanoseconds(Iterations,
+		[ComponentContext]() { return AActorSingleton::GetInstance<ABenchmarkActor>(ComponentContext); }));
+
+	SaveReport(Test, Report);
+}
+
+
+/* Thousands of duplicates spawned in a row while the instance exists, every single one must be rejected */
+/* static */ void FActorSingletonBenchmark::RunSpawnStorm(FAutomationTestBase& Test)
+{
+	using ABenchmarkActor = AActorSingletonBenchmarkActor000;
+	constexpr int32 SpawnCount = 10000;
+
+	FActorSingletonScopedWorld ScopedWorld(Test, TEXT("ActorSingletonBenchmark_SpawnStorm"));
+	if (!ScopedWorld.HasManager())
+	{
+		return;
+	}
+
+#if ACTORSINGLETON_WITH_LOGGING
+	Test.AddExpectedError(TEXT("can have only one instance of|duplicates of"), EAutomationExpectedErrorFlags::Contains, 0);
+#endif //ACTORSINGLETON_WITH_LOGGING
+
+	UWorld* const World = ScopedWorld.World;
+	ABenchmarkActor* const Instance = World->SpawnActor<ABenchmarkActor>();
+
+	int32 Survivors = 0;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < SpawnCount; ++i)
+	{
+		Survivors += IsValid(World->SpawnActor<ABenchmarkActor>()) ? 1 : 0;
+	}
+	const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	Test.TestEqual(TEXT("Every duplicate is rejected"), Survivors, 0);
+	Test.TestTrue(TEXT("Instance survives the storm"), AActorSingleton::GetInstance<ABenchmarkActor>(World) == Instance);
+
+	const TSharedRef<FJsonObject> Report = MakeReport(TEXT("SpawnStorm"));
+	Report->SetNumberField(TEXT("spawnCount"), SpawnCount);
+	Report->SetNumberField(TEXT("totalMs"), Seconds * 1e3);
+	Report->SetNumberField(TEXT("nsPerRejectedSpawn"), Seconds * 1e9 / SpawnCount);
+	Report->SetNumberField(TEXT("rejectedPerSecond"), SpawnCount / Seconds);
+	SaveReport(Test, Report);
+}
+
+
+/* Cost of a single duplicate with components: rejected before its components register (pre-spawn),
+*	vs spawned in full and destroyed afterwards, vs not spawned at all (TrySpawnSingleton) */
+/* static */ void FActorSingletonBenchmark::RunRejectedSpawnCost(FAutomationTestBase& Test)
+{
+	using ABenchmarkActor = AActorSingletonBenchmarkComponentsActor;
+	constexpr int32 SpawnCount = 1000;
+
+	FActorSingletonScopedWorld ScopedWorld(Test, TEXT("ActorSingletonBenchmark_RejectedSpawnCost"));
+	if (!ScopedWorld.HasManager())
+	{
+		return;
+	}
+
+#if ACTORSINGLETON_WITH_LOGGING
+	Test.AddExpectedError(TEXT("can have only one instance of|duplicates of"), EAutomationExpectedErrorFlags::Contains, 0);
+#endif //ACTORSINGLETON_WITH_LOGGING
+
+	UWorld* const World = ScopedWorld.World;
+	ABenchmarkActor* const Instance = World->SpawnActor<ABenchmarkActor>();
+
+	int32 Survivors = 0;
+	uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < SpawnCount; ++i)
+	{
+		Survivors += IsValid(World->SpawnActor<ABenchmarkActor>()) ? 1 : 0;
+	}
+	const double RejectedSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+	Test.TestEqual(TEXT("Every duplicate is rejected"), Survivors, 0);
+
+	StartCycles = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < SpawnCount; ++i)
+	{
+		World->SpawnActor<AActorSingletonBenchmarkComponentsTwin>()->Destroy();
+	}
+	const double SpawnAndDestroySeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	StartCycles = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < SpawnCount; ++i)
+	{
+		Survivors += AActorSingleton::TrySpawnSingleton<ABenchmarkActor>(World) != Instance ? 1 : 0;
+	}
+	const double TrySpawnSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+	Test.TestEqual(TEXT("TrySpawnSingleton returns the instance"), Survivors, 0);
+
+	const TSharedRef<FJsonObject> Report = MakeReport(TEXT("RejectedSpawnCost"));
+	Report->SetNumberField(TEXT("spawnCount"), SpawnCount);
+	Report->SetNumberField(TEXT("componentsPerActor"), Instance->GetComponents().Num());
+	Report->SetNumberField(TEXT("nsPerRejectedSpawn"), RejectedSeconds * 1e9 / SpawnCount);
+	Report->SetNumberField(TEXT("nsPerSpawnAndDestroy"), SpawnAndDestroySeconds * 1e9 / SpawnCount);
+	Report->SetNumberField(TEXT("nsPerTrySpawnSingleton"), TrySpawnSeconds * 1e9 / SpawnCount);
+	SaveReport(Test, Report);
+}
+
+
+/* Plugin's share of a frame in which the Editor reruns construction scripts of every singleton in the Level (e.g. while dragging them).
+* Registered instances leave right away, compared with the full duplicate resolution every rerun used to go through.
+* Only what AActorSingleton adds to a rerun is measured, the Editor and the construction scripts themselves need a Level Viewport. */
+/* static */ void FActorSingletonBenchmark::RunConstructionRerun(FAutomationTestBase& Test)
+{
+	constexpr int32 Frames = 1000;
+
+	FActorSingletonScopedWorld ScopedWorld(Test, TEXT("ActorSingletonBenchmark_ConstructionRerun"));
+	if (!ScopedWorld.HasManager())
+	{
+		return;
+	}
+
+	const TArray<AActorSingleton*> Instances = SpawnSingletons(ScopedWorld.World, GetBenchmarkClasses().Num());
+
+	uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 Frame = 0; Frame < Frames; ++Frame)
+	{
+		for (AActorSingleton* const Instance : Instances)
+		{
+			Instance->OnConstruction(Instance->GetActorTransform());
+		}
+	}
+	const double EarlyOutSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	/* Every instance goes through the whole resolution, finding itself in the registry */
+	StartCycles = FPlatformTime::Cycles64();
+	for (int32 Frame = 0; Frame < Frames; ++Frame)
+	{
+		for (AActorSingleton* const Instance : Instances)
+		{
+			FActorSingletonTestAccess::ResolveRegisteredInstance(Instance);
+		}
+	}
+	const double FullResolutionSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	Test.TestEqual(TEXT("Reruns never change the registry"), CountRegistered(ScopedWorld.Manager), Instances.Num());
+
+	const TSharedRef<FJsonObject> Report = MakeReport(TEXT("ConstructionRerun"));
+	Report->SetNumberField(TEXT("singletons"), Instances.Num());
+	Report->SetNumberField(TEXT("frames"), Frames);
+	Report->SetNumberField(TEXT("usPerFrameEarlyOut"), EarlyOutSeconds * 1e6 / Frames);
+	Report->SetNumberField(TEXT("usPerFrameFullResolution"), FullResolutionSeconds * 1e6 / Frames);
+	SaveReport(Test, Report);
+}
+
+
+/* Registration of the singletons loaded together with a Level, in UWorlds with more and more other Actors around.
+* Singletons queue themselves (see UActorSingletonManager::AddPendingInstance), so the time shouldn't depend on the other Actors. */
+/* static */ void FActorSingletonBenchmark::RunWorldInit(FAutomationTestBase& Test)
+{
+	const int32 SingletonCount = GetBenchmarkClasses().Num();
+
+	const TSharedRef<FJsonObject> Report = MakeReport(TEXT("WorldInit"));
+	Report->SetNumberField(TEXT("singletons"), SingletonCount);
+
+	TArray<TSharedPtr<FJsonValue>> Runs;
+	for (const int32 ActorCount : { 0, 1000, 10000 })
+	{
+		FActorSingletonScopedWorld ScopedWorld(Test, TEXT("ActorSingletonBenchmark_WorldInit"));
+		if (!ScopedWorld.HasManager())
+		{
+			return;
+		}
+
+		for (int32 i = 0; i < ActorCount; ++i)
+		{
+			ScopedWorld.World->SpawnActor<AActor>();
+		}
+		SpawnSingletons(ScopedWorld.World, SingletonCount);
+
+		/* Puts every singleton back into the pending queue, just like loading them together with the Level does */
+		FActorSingletonTestAccess::RemoveLevel(ScopedWorld.Manager, ScopedWorld.Level);
+
+		/* Second call on an already initialized Manager, but it's the very code that runs when the UWorld gets initialized */
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		ScopedWorld.Manager->PostInitialize();
+		const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+		Test.TestEqual(TEXT("Every pending singleton gets registered"), CountRegistered(ScopedWorld.Manager), SingletonCount);
+
+		const TSharedRef<FJsonObject> Run = MakeShared<FJsonObject>();
+		Run->SetNumberField(TEXT("otherActors"), ActorCount);
+		Run->SetNumberField(TEXT("postInitializeUs"), Seconds * 1e6);
+		Runs.Add(MakeShared<FJsonValueObject>(Run));
+	}
+
+	Report->SetArrayField(TEXT("runs"), Runs);
+	SaveReport(Test, Report);
+}
+
+
+/* Full GC with more and more registered singletons, and with the very same Actors evicted from the registry */
+/* static */ void FActorSingletonBenchmark::RunGarbageCollection(FAutomationTestBase& Test)
+{
+	constexpr int32 Collections = 5;
+	const int32 MaxSingletonCount = GetBenchmarkClasses().Num();
+
+	const TSharedRef<FJsonObject> Report = MakeReport(TEXT("GarbageCollection"));
+	Report->SetNumberField(TEXT("collections"), Collections);
+
+	TArray<TSharedPtr<FJsonValue>> Runs;
+	for (const int32 SingletonCount : { 0, 64, MaxSingletonCount })
+	{
+		FActorSingletonScopedWorld ScopedWorld(Test, TEXT("ActorSingletonBenchmark_GarbageCollection"));
+		if (!ScopedWorld.HasManager())
+		{
+			return;
+		}
+
+		SpawnSingletons(ScopedWorld.World, SingletonCount);
+
+		/* First purge also collects whatever previous runs (and tests) have left behind */
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+		const double RegisteredMs = MeasureGarbageCollection(Collections);
+		Test.TestEqual(TEXT("Registered instances survive GC"), CountRegistered(ScopedWorld.Manager), SingletonCount);
+
+		FActorSingletonTestAccess::RemoveLevel(ScopedWorld.Manager, ScopedWorld.Level);
+		const double EvictedMs = MeasureGarbageCollection(Collections);
+		FActorSingletonTestAccess::AddLevel(ScopedWorld.Manager, ScopedWorld.Level);
+		Test.TestEqual(TEXT("Evicted instances survive GC and register again"), CountRegistered(ScopedWorld.Manager), SingletonCount);
+
+		const TSharedRef<FJsonObject> Run = MakeShared<FJsonObject>();
+		Run->SetNumberField(TEXT("singletons"), SingletonCount);
+		Run->SetNumberField(TEXT("gcRegisteredMs"), RegisteredMs);
+		Run->SetNumberField(TEXT("gcEvictedMs"), EvictedMs);
+		Runs.Add(MakeShared<FJsonValueObject>(Run));
+	}
+
+	Report->SetArrayField(TEXT("runs"), Runs);
+	SaveReport(Test, Report);
+}
+
+
+/* Slot registry vs the map keyed by FinalParent that it replaced, with hundreds of singleton classes:
+*	lookup time, memory, and GC time with many copies of each layout alive */
+/* static */ void FActorSingletonBenchmark::RunRegistryLayout(FAutomationTestBase& Test)
+{
+	constexpr int32 Iterations = 1000000;
+	constexpr int32 RegistryCopies = 1000;
+	constexpr int32 Collections = 5;
+
+	FActorSingletonScopedWorld ScopedWorld(Test, TEXT("ActorSingletonBenchmark_RegistryLayout"));
+	if (!ScopedWorld.HasManager())
+	{
+		return;
+	}
+
+	const TArray<AActorSingleton*> Instances = SpawnSingletons(ScopedWorld.World, GetBenchmarkClasses().Num());
+	const int32 SingletonCount = Instances.Num();
+
+	TArray<TSubclassOf<AActorSingleton>> FinalParents;
+	TArray<int32> Slots;
+	TMap<TSubclassOf<AActorSingleton>, AActorSingleton*> MapInstances;
+	for (AActorSingleton* const Instance : Instances)
+	{
+		FinalParents.Add(FActorSingletonTestAccess::GetFinalParent(Instance));
+		Slots.Add(FActorSingletonTestAccess::GetSlotIndex(FinalParents.Last()));
+		MapInstances.Add(FinalParents.Last(), Instance);
+	}
+
+	const UActorSingletonManager* const Manager = ScopedWorld.Manager;
+	bool bSameResults = true;
+	for (int32 i = 0; i < SingletonCount; ++i)
+	{
+		bSameResults &= FActorSingletonTestAccess::GetInstanceAtSlot(Manager, Slots[i]) == Instances[i] && MapInstances[FinalParents[i]] == Instances[i];
+	}
+	Test.TestTrue(TEXT("Both layouts find every instance"), bSameResults);
+
+	const TSharedRef<FJsonObject> Report = MakeReport(TEXT("RegistryLayout"));
+	Report->SetNumberField(TEXT("singletons"), SingletonCount);
+	Report->SetNumberField(TEXT("iterations"), Iterations);
+
+	/* Every lookup asks for another class, so neither layout gets to stay in a single cache line */
+	int32 Next = 0;
+	Report->SetNumberField(TEXT("slotLookupNs"), MeasureNanoseconds(Iterations,
+		[Manager, &Slots, &Next]() { Next = (Next + 1) % Slots.Num(); return FActorSingletonTestAccess::GetInstanceAtSlot(Manager, Slots[Next]); }));
+	Report->SetNumberField(TEXT("mapLookupNs"), MeasureNanoseconds(Iterations,
+		[&MapInstances, &FinalParents, &Next]()
+		{
+			Next = (Next + 1) % FinalParents.Num();
+			return MapInstances.Contains(FinalParents[Next]) ? MapInstances[FinalParents[Next]] : nullptr;
+		}));
+
+	Report->SetNumberField(TEXT("slotBytes"), FActorSingletonTestAccess::GetInstanceSlots(Manager).GetAllocatedSize());
+	Report->SetNumberField(TEXT("mapBytes"), MapInstances.GetAllocatedSize());
+
+	/* Keeps RegistryCopies registries alive (rooted) for the duration of a single measurement */
+	const auto MeasureCollectionWith = [](const TFunctionRef<UObject*()> MakeRegistry)
+	{
+		TArray<UObject*> Registries;
+		for (int32 i = 0; i < RegistryCopies; ++i)
+		{
+			Registries.Add(MakeRegistry());
+			Registries.Last()->AddToRoot();
+		}
+
+		const double Milliseconds = MeasureGarbageCollection(Collections);
+
+		for (UObject* const Registry : Registries)
+		{
+			Registry->RemoveFromRoot();
+		}
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		return Milliseconds;
+	};
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+	Report->SetNumberField(TEXT("registryCopies"), RegistryCopies);
+	Report->SetNumberField(TEXT("gcBaselineMs"), MeasureGarbageCollection(Collections));
+	Report->SetNumberField(TEXT("gcSlotRegistriesMs"), MeasureCollectionWith([Manager]() -> UObject*
+		{
+			UActorSingletonBenchmarkSlotRegistry* const Registry = NewObject<UActorSingletonBenchmarkSlotRegistry>();
+			Registry->InstanceSlots = FActorSingletonTestAccess::GetInstanceSlots(Manager);
+			return Registry;
+		}));
+	Report->SetNumberField(TEXT("gcMapRegistriesMs"), MeasureCollectionWith([&MapInstances]() -> UObject*
+		{
+			UActorSingletonBenchmarkMapRegistry* const Registry = NewObject<UActorSingletonBenchmarkMapRegistry>();
+			Registry->Instances = MapInstances;
+			return Registry;
+		}));
+
+	Test.TestEqual(TEXT("Registered instances survive GC"), CountRegistered(ScopedWorld.Manager), SingletonCount);
+
+	SaveReport(Test, Report);
+}
+
+
+/* Removing and adding back a Level with more and more singletons, through the same handlers that level streaming goes through */
+/* static */ void FActorSingletonBenchmark::RunStreaming(FAutomationTestBase& Test)
+{
+	constexpr int32 Iterations = 100;
+	const int32 MaxSingletonCount = GetBenchmarkClasses().Num();
+
+	const TSharedRef<FJsonObject> Report = MakeReport(TEXT("Streaming"));
+	Report->SetNumberField(TEXT("iterations"), Iterations);
+
+	TArray<TSharedPtr<FJsonValue>> Runs;
+	for (const int32 SingletonCount : { 1, 16, MaxSingletonCount })
+	{
+		FActorSingletonScopedWorld ScopedWorld(Test, TEXT("ActorSingletonBenchmark_Streaming"));
+		if (!ScopedWorld.HasManager())
+		{
+			return;
+		}
+
+		SpawnSingletons(ScopedWorld.World, SingletonCount);
+
+		uint64 RemoveCycles = 0;
+		uint64 AddCycles = 0;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			FActorSingletonTestAccess::RemoveLevel(ScopedWorld.Manager, ScopedWorld.Level);
+			const uint64 RemovedCycles = FPlatformTime::Cycles64();
+			FActorSingletonTestAccess::AddLevel(ScopedWorld.Manager, ScopedWorld.Level);
+			const uint64 AddedCycles = FPlatformTime::Cycles64();
+
+			RemoveCycles += RemovedCycles - StartCycles;
+			AddCycles += AddedCycles - RemovedCycles;
+		}
+
+		Test.TestEqual(TEXT("Every singleton is registered again once its Level is back"), CountRegistered(ScopedWorld.Manager), SingletonCount);
+
+		const TSharedRef<FJsonObject> Run = MakeShared<FJsonObject>();
+		Run->SetNumberField(TEXT("singletons"), SingletonCount);
+		Run->SetNumberField(TEXT("levelRemovedUs"), FPlatformTime::ToSeconds64(RemoveCycles) * 1e6 / Iterations);
+		Run->SetNumberField(TEXT("levelAddedUs"), FPlatformTime::ToSeconds64(AddCycles) * 1e6 / Iterations);
+		Runs.Add(MakeShared<FJsonValueObject>(Run));
+	}
+
+	Report->SetArrayField(TEXT("runs"), Runs);
+	SaveReport(Test, Report);
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,80 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "ActorSingletonTestHelpers.h"
+
+class AActorSingleton;
+class UActorSingletonManager;
+
+/*================================================================================
+=	Actor Singleton Benchmark:
+=
+=	Automation tests under 'Plugins.ActorSingleton.Benchmark', each one measuring a single part of the plugin
+=		on a transient Game UWorld filled with AActorSingletonBenchmarkActor sub-classes.
+=	Every test verifies what it measures (so it can't get faster by doing less),
+=		and saves the results as JSON into 'Saved/Profiling/ActorSingleton' (and into the automation report),
+=		so they can be compared between versions of the plugin.
+=
+=	Runs headless, e.g.:
+=		UnrealEditor-Cmd <Project> -nullrhi -unattended -nosplash -ExecCmds="Automation RunTests Plugins.ActorSingleton.Benchmark;Quit"
+=
+================================================================================*/
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/* Shared parts of every benchmark, internals of the plugin are only reached through FActorSingletonTestAccess */
+struct FActorSingletonBenchmark
+{
+	/* Average time of a single call of given Function, in nanoseconds */
+	template<typename FunctionType>
+	static double MeasureNanoseconds(const int32 Iterations, FunctionType&& Function)
+	{
+		/* Results are folded into something that outlives the loop, so the compiler can't throw the calls away */
+		volatile UPTRINT Sink = 0;
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Sink = Sink ^ reinterpret_cast<UPTRINT>(Function());
+		}
+		const uint64 EndCycles = FPlatformTime::Cycles64();
+		return FPlatformTime::ToSeconds64(EndCycles - StartCycles) * 1e9 / Iterations;
+	}
+
+	/* Average time of a full purge, in milliseconds */
+	static double MeasureGarbageCollection(const int32 Collections);
+
+	/* Every sub-class of AActorSingletonBenchmarkActor, always in the same order */
+	static TArray<UClass*> GetBenchmarkClasses();
+
+	/* Spawns one instance of each of the first 'Count' benchmark classes */
+	static TArray<AActorSingleton*> SpawnSingletons(UWorld* const World, const int32 Count);
+
+	/* Number of instances currently registered in given Manager */
+	static int32 CountRegistered(const UActorSingletonManager* const Manager);
+
+	/* New report with the fields shared by every benchmark */
+	static TSharedRef<FJsonObject> MakeReport(const FString& Name);
+
+	/* Saves given report into 'Saved/Profiling/ActorSingleton' and adds it to the automation report */
+	static void SaveReport(FAutomationTestBase& Test, const TSharedRef<FJsonObject>& Report);
+
+	/* Scenarios, each one is run by a single automation test */
+	static void RunLookup(FAutomationTestBase& Test);
+	static void RunTypedLookup(FAutomationTestBase& Test);
+	static void RunAnyThreadStress(FAutomationTestBase& Test);
+	static void RunWorldResolution(FAutomationTestBase& Test);
+	static void RunSpawnStorm(FAutomationTestBase& Test);
+	static void RunRejectedSpawnCost(FAutomationTestBase& Test);
+	static void RunConstructionRerun(FAutomationTestBase& Test);
+	static void RunWorldInit(FAutomationTestBase& Test);
+	static void RunGarbageCollection(FAutomationTestBase& Test);
+	static void RunRegistryLayout(FAutomationTestBase& Test);
+	static void RunStreaming(FAutomationTestBase& Test);
+};
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,1608 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActorSingleton.h"
+#include "Components/SceneComponent.h"
+#include "ActorSingletonBenchmarkActors.generated.h"
+
+/*================================================================================
+=	Actor Singleton Benchmark Actors:
+=
+=	Singletons used only by the benchmarks (see ActorSingletonBenchmark.h), never placed nor spawned anywhere else.
+=	Every numbered class is a FinalParent of its own, so a single UWorld can hold as many instances as there are classes,
+=		which is what measuring the registry with hundreds of singletons requires.
+=	The list is plain and explicit on purpose, UHT can't see classes declared by a macro.
+=
+================================================================================*/
+
+/* Gives given Actor a root with a few children, so spawning it registers some components */
+inline void CreateActorSingletonBenchmarkComponents(AActor* const Actor)
+{
+	USceneComponent* const Root = Actor->CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+	Actor->SetRootComponent(Root);
+	for (int32 i = 0; i < 8; ++i)
+	{
+		USceneComponent* const Child = Actor->CreateDefaultSubobject<USceneComponent>(FName(TEXT("Child"), i));
+		Child->SetupAttachment(Root);
+	}
+}
+
+/* Singleton with components, see AActorSingletonBenchmarkComponentsTwin */
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkComponentsActor : public AActorSingleton
+{
+	GENERATED_BODY()
+
+public:
+	AActorSingletonBenchmarkComponentsActor()
+	{
+		CreateActorSingletonBenchmarkComponents(this);
+	}
+};
+
+/* Same Actor, but not a singleton. Spawning and destroying it is what a rejected duplicate would cost,
+*	if it was only caught once it's fully spawned (e.g. in OnConstruction). */
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkComponentsTwin : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AActorSingletonBenchmarkComponentsTwin()
+	{
+		CreateActorSingletonBenchmarkComponents(this);
+	}
+};
+
+/* Declared root (see ACTORSINGLETON_ROOT), AActorSingleton::GetInstance<T> resolves its slot without touching any CDO */
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkRoot : public AActorSingleton
+{
+	GENERATED_BODY()
+	ACTORSINGLETON_ROOT(AActorSingletonBenchmarkRoot)
+};
+
+/* Not a FinalParent (it's Abstract), so each sub-class is one */
+UCLASS(Abstract, NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor : public AActorSingleton
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor000 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor001 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor002 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor003 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor004 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor005 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor006 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor007 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor008 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor009 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor010 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor011 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor012 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor013 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor014 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor015 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor016 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor017 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor018 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor019 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor020 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor021 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor022 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor023 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor024 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor025 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor026 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor027 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor028 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor029 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor030 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor031 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor032 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor033 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor034 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor035 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor036 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor037 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor038 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor039 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor040 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor041 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor042 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor043 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor044 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor045 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor046 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor047 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor048 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor049 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor050 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor051 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor052 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor053 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor054 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor055 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor056 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor057 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor058 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor059 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor060 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor061 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor062 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor063 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor064 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor065 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor066 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor067 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor068 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor069 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor070 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor071 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor072 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor073 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor074 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor075 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor076 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor077 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor078 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor079 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor080 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor081 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor082 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor083 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor084 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor085 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor086 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor087 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor088 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor089 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor090 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor091 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor092 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor093 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor094 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor095 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor096 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor097 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor098 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor099 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor100 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor101 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor102 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor103 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor104 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor105 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor106 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor107 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor108 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor109 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor110 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor111 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor112 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor113 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor114 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor115 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor116 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor117 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor118 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor119 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor120 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor121 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor122 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor123 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor124 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor125 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor126 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor127 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor128 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor129 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor130 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor131 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor132 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor133 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor134 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor135 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor136 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor137 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor138 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor139 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor140 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor141 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor142 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor143 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor144 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor145 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor146 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor147 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor148 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor149 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor150 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor151 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor152 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor153 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor154 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor155 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor156 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor157 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor158 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor159 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor160 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor161 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor162 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor163 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor164 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor165 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor166 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor167 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor168 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor169 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor170 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor171 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor172 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor173 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor174 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor175 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor176 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor177 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor178 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor179 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor180 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor181 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor182 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor183 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor184 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor185 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor186 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor187 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor188 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor189 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor190 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor191 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor192 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor193 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor194 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor195 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor196 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor197 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor198 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor199 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor200 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor201 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor202 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor203 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor204 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor205 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor206 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor207 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor208 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor209 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor210 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor211 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor212 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor213 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor214 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor215 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor216 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor217 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor218 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor219 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor220 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor221 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor222 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor223 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor224 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor225 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor226 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor227 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor228 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor229 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor230 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor231 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor232 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor233 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor234 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor235 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor236 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor237 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor238 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor239 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor240 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor241 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor242 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor243 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor244 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor245 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor246 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor247 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor248 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor249 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor250 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor251 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor252 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor253 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor254 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable, NotBlueprintable, HideDropdown)
+class AActorSingletonBenchmarkActor255 : public AActorSingletonBenchmarkActor
+{
+	GENERATED_BODY()
+};
@@ -0,0 +1,37 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActorSingleton.h"
+#include "ActorSingletonBenchmarkRegistries.generated.h"
+
+/*================================================================================
+=	Actor Singleton Benchmark Registries:
+=
+=	Stand-alone copies of the registry layouts, so their Garbage Collection cost can be measured
+=		on their own, with many copies, without the rest of UActorSingletonManager around.
+=
+================================================================================*/
+
+/* Layout of the registry that UActorSingletonManager used to have: FinalParent mapped to its instance */
+UCLASS(Transient)
+class UActorSingletonBenchmarkMapRegistry : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TMap<TSubclassOf<AActorSingleton>, AActorSingleton*> Instances;
+};
+
+/* Layout of UActorSingletonManager::InstanceSlots */
+UCLASS(Transient)
+class UActorSingletonBenchmarkSlotRegistry : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<AActorSingleton*> InstanceSlots;
+};
@@ -0,0 +1,195 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#include "ActorSingleton.h"
+#include "ActorSingletonBenchmark.h"
+#include "ActorSingletonBenchmarkActors.h"
+#include "ActorSingletonTestAccess.h"
+#include "ActorSingletonTestHelpers.h"
+#include "ActorSingletonTestListener.h"
+#include "Engine/World.h"
+#include "UObject/StrongObjectPtr.h"
+
+/*================================================================================
+=	Actor Singleton Instance Changed Tests:
+=
+=	Automation tests under 'Plugins.ActorSingleton.InstanceChanged', covering UActorSingletonManager::OnInstanceChanged,
+=		AActorSingleton::BindOnInstanceChanged and AActorSingleton::WaitForInstance.
+=	Listeners must be called exactly once per change, even when they subscribe to something else in the meantime,
+=		and must only ever see the registry (and the snapshot read by other threads) in the state they're being told about.
+=
+================================================================================*/
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+static constexpr uint32 InstanceChangedTestFlags =
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter;
+
+
+/* Spawning and destroying a single instance, both native and dynamic listeners get told about each change once */
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonInstanceChangedRegisterAndEvictTest, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.InstanceChanged.RegisterAndEvict", InstanceChangedTestFlags)
+bool FActorSingletonInstanceChangedRegisterAndEvictTest::RunTest(const FString& Parameters)
+{
+	using ATestActor = AActorSingletonBenchmarkActor000;
+
+	FActorSingletonScopedWorld ScopedWorld(*this, TEXT("ActorSingletonTest_RegisterAndEvict"));
+	if (!ScopedWorld.HasManager())
+	{
+		return false;
+	}
+
+	UWorld* const World = ScopedWorld.World;
+	UActorSingletonManager* const Manager = ScopedWorld.Manager;
+
+	TArray<TPair<AActorSingleton*, AActorSingleton*>> NativeCalls;
+	bool bConsistent = true;
+	const FDelegateHandle Handle = Manager->OnInstanceChanged(ATestActor::StaticClass()).AddLambda(
+		[&NativeCalls, &bConsistent, World, Manager](AActorSingleton* const NewInstance, AActorSingleton* const OldInstance)
+		{
+			NativeCalls.Emplace(NewInstance, OldInstance);
+			bConsistent &= AActorSingleton::GetInstance<ATestActor>(World) == NewInstance
+				&& AActorSingleton::GetInstanceAnyThread<ATestActor>(Manager) == NewInstance;
+		});
+
+	const TStrongObjectPtr<UActorSingletonTestListener> Listener(NewObject<UActorSingletonTestListener>());
+	AActorSingleton::BindOnInstanceChanged(World, ATestActor::StaticClass(), Listener->MakeEvent());
+
+	ATestActor* const Instance = World->SpawnActor<ATestActor>();
+	TestEqual(TEXT("Registration is broadcast once"), NativeCalls.Num(), 1);
+	TestTrue(TEXT("Registration is broadcast with the new instance"),
+		NativeCalls.Num() == 1 && NativeCalls[0].Key == Instance && NativeCalls[0].Value == nullptr);
+
+	Instance->Destroy();
+	TestEqual(TEXT("Eviction is broadcast once"), NativeCalls.Num(), 2);
+	TestTrue(TEXT("Eviction is broadcast with the old instance"),
+		NativeCalls.Num() == 2 && NativeCalls[1].Key == nullptr && NativeCalls[1].Value == Instance);
+
+	TestTrue(TEXT("Dynamic listener gets the very same calls"), Listener->Calls == NativeCalls);
+	TestTrue(TEXT("Listeners see the registry and the snapshot in the state they're told about"), bConsistent);
+
+	Manager->OnInstanceChanged(ATestActor::StaticClass()).Remove(Handle);
+	AActorSingleton::UnbindOnInstanceChanged(World, ATestActor::StaticClass(), Listener->MakeEvent());
+	return !HasAnyErrors();
+}
+
+
+/* Listener that starts listening to many other FinalParents from within the broadcast (which grows the map of listeners),
+*	the rest of the same broadcast must still reach everyone, and the new listeners must work too */
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonInstanceChangedReentrantSubscribeTest, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.InstanceChanged.ReentrantSubscribe", InstanceChangedTestFlags)
+bool FActorSingletonInstanceChangedReentrantSubscribeTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 LateClassCount = 64;
+
+	FActorSingletonScopedWorld ScopedWorld(*this, TEXT("ActorSingletonTest_ReentrantSubscribe"));
+	if (!ScopedWorld.HasManager())
+	{
+		return false;
+	}
+
+	UWorld* const World = ScopedWorld.World;
+	UActorSingletonManager* const Manager = ScopedWorld.Manager;
+	const TArray<UClass*> Classes = FActorSingletonBenchmark::GetBenchmarkClasses();
+	check(Classes.Num() > LateClassCount)
+
+	const TStrongObjectPtr<UActorSingletonTestListener> Listener(NewObject<UActorSingletonTestListener>());
+	const TStrongObjectPtr<UActorSingletonTestListener> LateListener(NewObject<UActorSingletonTestListener>());
+	int32 LateNativeCalls = 0;
+
+	Manager->OnInstanceChanged(Classes[0]).AddLambda(
+		[&LateNativeCalls, &Classes, &LateListener, World, Manager](AActorSingleton* const NewInstance, AActorSingleton*)
+		{
+			if (!NewInstance)
+			{
+				return;
+			}
+
+			for (int32 i = 1; i <= LateClassCount; ++i)
+			{
+				Manager->OnInstanceChanged(Classes[i]).AddLambda([&LateNativeCalls](AActorSingleton*, AActorSingleton*) { ++LateNativeCalls; });
+				AActorSingleton::BindOnInstanceChanged(World, Classes[i], LateListener->MakeEvent());
+			}
+		});
+	AActorSingleton::BindOnInstanceChanged(World, Classes[0], Listener->MakeEvent());
+
+	AActorSingleton* const Instance = World->SpawnActor<AActorSingleton>(Classes[0]);
+	TestEqual(TEXT("Dynamic listener is called after the native one has subscribed to other classes"), Listener->Calls.Num(), 1);
+	TestTrue(TEXT("Dynamic listener gets the new instance"), Listener->Calls.Num() == 1 && Listener->Calls[0].Key == Instance);
+
+	World->SpawnActor<AActorSingleton>(Classes[1]);
+	TestEqual(TEXT("Native listener subscribed within the broadcast works"), LateNativeCalls, 1);
+	TestEqual(TEXT("Dynamic listener subscribed within the broadcast works"), LateListener->Calls.Num(), 1);
+
+	for (int32 i = 0; i <= LateClassCount; ++i)
+	{
+		Manager->OnInstanceChanged(Classes[i]).Clear();
+		AActorSingleton::UnbindOnInstanceChanged(World, Classes[i], i == 0 ? Listener->MakeEvent() : LateListener->MakeEvent());
+	}
+	return !HasAnyErrors();
+}
+
+
+/* Removing and adding back a Level with many singletons: listeners and promises are only told about the changes once the whole Level is done,
+*	so each of them sees every other instance of the Level evicted (or registered) already, both in the registry and in the snapshot */
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FActorSingletonInstanceChangedLevelBatchTest, FActorSingletonTestBase,
+	"Plugins.ActorSingleton.InstanceChanged.LevelBatch", InstanceChangedTestFlags)
+bool FActorSingletonInstanceChangedLevelBatchTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 SingletonCount = 16;
+
+	FActorSingletonScopedWorld ScopedWorld(*this, TEXT("ActorSingletonTest_LevelBatch"));
+	if (!ScopedWorld.HasManager())
+	{
+		return false;
+	}
+
+	UWorld* const World = ScopedWorld.World;
+	UActorSingletonManager* const Manager = ScopedWorld.Manager;
+	const TArray<AActorSingleton*> Instances = FActorSingletonBenchmark::SpawnSingletons(World, SingletonCount);
+
+	int32 Calls = 0;
+	int32 ExpectedRegistered = 0;
+	bool bConsistent = true;
+	TArray<FDelegateHandle> Handles;
+	for (int32 i = 0; i < SingletonCount; ++i)
+	{
+		Handles.Add(Manager->OnInstanceChanged(Instances[i]->GetClass()).AddLambda(
+			[&Calls, &ExpectedRegistered, &bConsistent, &Instances, Manager, i](AActorSingleton* const NewInstance, AActorSingleton* const OldInstance)
+			{
+				++Calls;
+				bConsistent &= (NewInstance ? NewInstance : OldInstance) == Instances[i]
+					&& FActorSingletonBenchmark::CountRegistered(Manager) == ExpectedRegistered
+					&& Manager->GetInstanceAnyThread(Instances[i]->GetClass()) == NewInstance;
+			}));
+	}
+
+	ExpectedRegistered = 0;
+	FActorSingletonTestAccess::RemoveLevel(Manager, ScopedWorld.Level);
+	TestEqual(TEXT("Every eviction is broadcast once"), Calls, SingletonCount);
+
+	bool bFulfilled = false;
+	bool bFulfilledConsistent = false;
+	TFuture<void> Waiting = AActorSingleton::WaitForInstance(World, Instances[0]->GetClass()).Next(
+		[&bFulfilled, &bFulfilledConsistent, &Instances, Manager](AActorSingleton* const Instance)
+		{
+			bFulfilled = Instance == Instances[0];
+			bFulfilledConsistent = FActorSingletonBenchmark::CountRegistered(Manager) == SingletonCount;
+		});
+	TestFalse(TEXT("Promise waits while the Level is away"), bFulfilled);
+
+	Calls = 0;
+	ExpectedRegistered = SingletonCount;
+	FActorSingletonTestAccess::AddLevel(Manager, ScopedWorld.Level);
+	TestEqual(TEXT("Every registration is broadcast once"), Calls, SingletonCount);
+	TestTrue(TEXT("Promise is fulfilled once the Level is back"), bFulfilled);
+	TestTrue(TEXT("Promise is fulfilled once the whole Level is registered"), bFulfilledConsistent);
+	TestTrue(TEXT("Listeners are only called once the whole Level is done"), bConsistent);
+
+	for (int32 i = 0; i < SingletonCount; ++i)
+	{
+		Manager->OnInstanceChanged(Instances[i]->GetClass()).Remove(Handles[i]);
+	}
+	return !HasAnyErrors();
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
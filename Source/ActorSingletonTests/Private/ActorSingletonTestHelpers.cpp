@@ -0,0 +1,30 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#include "ActorSingletonTestHelpers.h"
+#include "ActorSingleton.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+FActorSingletonScopedWorld::FActorSingletonScopedWorld(FAutomationTestBase& Test, const TCHAR* const Name)
+{
+	World = UWorld::CreateWorld(EWorldType::Game, false, FName(Name));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	Level = World->PersistentLevel;
+	Manager = World->GetSubsystem<UActorSingletonManager>();
+	Test.TestNotNull(TEXT("UActorSingletonManager exists in Game Worlds"), Manager);
+}
+
+
+FActorSingletonScopedWorld::~FActorSingletonScopedWorld()
+{
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
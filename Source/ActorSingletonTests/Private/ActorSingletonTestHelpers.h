@@ -0,0 +1,48 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+class UActorSingletonManager;
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/* Base of every test in this module, see IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST */
+class FActorSingletonTestBase : public FAutomationTestBase
+{
+public:
+	FActorSingletonTestBase(const FString& InName, const bool bInComplexTask)
+		: FAutomationTestBase(InName, bInComplexTask)
+	{
+	}
+
+	/* Every registration logs a warning (in builds with ACTORSINGLETON_WITH_LOGGING) and tests do plenty of them.
+	* Results are verified explicitly instead. */
+	virtual bool SuppressLogWarnings() override
+	{
+		return true;
+	}
+};
+
+
+/* Game UWorld that lives for the duration of a single scope, with its UActorSingletonManager.
+* Manager always exists in Game UWorlds (unless UActorSingletonSettings say otherwise), so a missing one fails given test right away,
+*	and the test only has to bail out when FActorSingletonScopedWorld::HasManager returns 'false'. */
+struct FActorSingletonScopedWorld
+{
+	FActorSingletonScopedWorld(FAutomationTestBase& Test, const TCHAR* const Name);
+	~FActorSingletonScopedWorld();
+
+	bool HasManager() const
+	{
+		return Manager != nullptr;
+	}
+
+	UWorld* World = nullptr;
+	ULevel* Level = nullptr;
+	UActorSingletonManager* Manager = nullptr;
+};
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,33 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActorSingleton.h"
+#include "ActorSingletonTestListener.generated.h"
+
+/* Target of FOnActorSingletonInstanceChangedDynamic in the tests (dynamic delegates can only be bound to a UFUNCTION),
+*	remembers every call it gets, in order. */
+UCLASS(Transient)
+class UActorSingletonTestListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/* Delegate bound to UActorSingletonTestListener::HandleInstanceChanged of 'this' */
+	FOnActorSingletonInstanceChangedDynamic MakeEvent()
+	{
+		FOnActorSingletonInstanceChangedDynamic Event;
+		Event.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UActorSingletonTestListener, HandleInstanceChanged));
+		return Event;
+	}
+
+	UFUNCTION()
+	void HandleInstanceChanged(AActorSingleton* NewInstance, AActorSingleton* OldInstance)
+	{
+		Calls.Emplace(NewInstance, OldInstance);
+	}
+
+	TArray<TPair<AActorSingleton*, AActorSingleton*>> Calls;
+};
@@ -0,0 +1,26 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+using UnrealBuildTool;
+
+public class ActorSingletonUncooked : ModuleRules
+{
+	public ActorSingletonUncooked(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"BlueprintGraph",
+		});
+
+		PrivateDependencyModuleNames.AddRange(new string[]
+		{
+			"ActorSingleton",
+			"KismetCompiler",
+			"UnrealEd",
+		});
+	}
+}
@@ -0,0 +1,6 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#include "Modules/ModuleManager.h"
+
+/* Blueprint nodes only, nothing to start up */
+IMPLEMENT_MODULE(FDefaultModuleImpl, ActorSingletonUncooked)
@@ -0,0 +1,167 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#include "K2Node_GetActorSingletonCached.h"
+#include "ActorSingleton.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_TemporaryVariable.h"
+#include "KismetCompiler.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+
+#define LOCTEXT_NAMESPACE "K2Node_GetActorSingletonCached"
+
+static const FName ClassPinName = TEXT("Class");
+static const FName CachePinName = TEXT("Cache");
+
+
+/* virtual override */ void UK2Node_GetActorSingletonCached::AllocateDefaultPins()
+{
+	UEdGraphPin* const ClassPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Class, AActorSingleton::StaticClass(), ClassPinName);
+	ClassPin->DefaultObject = SingletonClass;
+
+	/* Class must be known while compiling, so it can't come from another node */
+	ClassPin->bNotConnectable = true;
+
+	UClass* const ResultClass = SingletonClass ? SingletonClass.Get() : AActorSingleton::StaticClass();
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Object, ResultClass, UEdGraphSchema_K2::PN_ReturnValue);
+
+	Super::AllocateDefaultPins();
+}
+
+
+/* virtual override */ FText UK2Node_GetActorSingletonCached::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	if (SingletonClass && TitleType != ENodeTitleType::MenuTitle)
+	{
+		return FText::Format(LOCTEXT("NodeTitleWithClass", "Get {0} (Cached)"), SingletonClass->GetDisplayNameText());
+	}
+	return LOCTEXT("NodeTitle", "Get Actor Singleton (Cached)");
+}
+
+
+/* virtual override */ FText UK2Node_GetActorSingletonCached::GetTooltipText() const
+{
+	return LOCTEXT("NodeTooltip",
+		"Gets a reference to the single instance of chosen Actor Singleton class within current World.\n"
+		"Instance is resolved only once and reused until any instance gets registered or evicted,\n"
+		"so it's cheap to use it for many pins and every frame.");
+}
+
+
+/* virtual override */ void UK2Node_GetActorSingletonCached::PinDefaultValueChanged(UEdGraphPin* Pin)
+{
+	Super::PinDefaultValueChanged(Pin);
+
+	if (Pin != GetClassPin() || Pin->DefaultObject == SingletonClass)
+	{
+		return;
+	}
+
+	SingletonClass = Cast<UClass>(Pin->DefaultObject);
+
+	/* Result pin changes its type, so links that no longer fit will be dropped */
+	GetSchema()->ReconstructNode(*this);
+	FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+}
+
+
+/* virtual override */ bool UK2Node_GetActorSingletonCached::IsCompatibleWithGraph(const UEdGraph* TargetGraph) const
+{
+	/* Cache lives in a member variable, so there must be an instance of the Blueprint to keep it in */
+	const UBlueprint* const Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(TargetGraph);
+	const bool bHasInstances = Blueprint
+		&& (Blueprint->BlueprintType == BPTYPE_Normal || Blueprint->BlueprintType == BPTYPE_LevelScript);
+	return bHasInstances && Super::IsCompatibleWithGraph(TargetGraph);
+}
+
+
+/* virtual override */ void UK2Node_GetActorSingletonCached::ValidateNodeDuringCompilation(FCompilerResultsLog& MessageLog) const
+{
+	Super::ValidateNodeDuringCompilation(MessageLog);
+
+	if (!SingletonClass)
+	{
+		MessageLog.Error(*LOCTEXT("NoClass", "@@ must have a Class picked").ToString(), this);
+		return;
+	}
+
+	/* Resolved once here, so a class that can never be registered fails the compilation instead of returning 'nullptr' at runtime */
+	AActorSingleton* const CDO = SingletonClass->GetDefaultObject<AActorSingleton>();
+	if (!CDO->GetFinalParent())
+	{
+		MessageLog.Error(*FText::Format(
+			LOCTEXT("NoFinalParent", "@@ uses '{0}' which has no FinalParent (IsFinalParent returns 'false' for all of its classes)"),
+			SingletonClass->GetDisplayNameText()).ToString(), this);
+	}
+}
+
+
+/* virtual override */ void UK2Node_GetActorSingletonCached::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	UClass* const ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		UBlueprintNodeSpawner* const NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+		check(NodeSpawner)
+		ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+	}
+}
+
+
+/* virtual override */ FText UK2Node_GetActorSingletonCached::GetMenuCategory() const
+{
+	return LOCTEXT("MenuCategory", "Actor Singleton");
+}
+
+
+/* virtual override */ void UK2Node_GetActorSingletonCached::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	if (!SingletonClass)
+	{
+		BreakAllNodeLinks();
+		return;
+	}
+
+	const UEdGraphSchema_K2* const Schema = CompilerContext.GetSchema();
+
+	/* Persistent internal variable becomes a (hidden) member of the generated class, one per node */
+	UK2Node_TemporaryVariable* const CacheNode = CompilerContext.SpawnInternalVariable(
+		this, UEdGraphSchema_K2::PC_Struct, NAME_None, FActorSingletonCachedReference::StaticStruct());
+
+	UK2Node_CallFunction* const CallNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	CallNode->FunctionReference.SetExternalMember(GET_FUNCTION_NAME_CHECKED(AActorSingleton, GetInstanceCached), AActorSingleton::StaticClass());
+	CallNode->AllocateDefaultPins();
+
+	CallNode->FindPinChecked(ClassPinName)->DefaultObject = SingletonClass;
+	bool bSuccess = Schema->TryCreateConnection(CacheNode->GetVariablePin(), CallNode->FindPinChecked(CachePinName));
+
+	/* Copy the type, so the result doesn't have to be casted */
+	UEdGraphPin* const CallResultPin = CallNode->GetReturnValuePin();
+	CallResultPin->PinType = GetResultPin()->PinType;
+	bSuccess &= CompilerContext.MovePinLinksToIntermediate(*GetResultPin(), *CallResultPin).CanSafeConnect();
+
+	if (!bSuccess)
+	{
+		CompilerContext.MessageLog.Error(*LOCTEXT("ExpandFailed", "Internal error while expanding @@").ToString(), this);
+	}
+
+	BreakAllNodeLinks();
+}
+
+
+UEdGraphPin* UK2Node_GetActorSingletonCached::GetClassPin() const
+{
+	return FindPinChecked(ClassPinName);
+}
+
+
+UEdGraphPin* UK2Node_GetActorSingletonCached::GetResultPin() const
+{
+	return FindPinChecked(UEdGraphSchema_K2::PN_ReturnValue);
+}
+
+#undef LOCTEXT_NAMESPACE
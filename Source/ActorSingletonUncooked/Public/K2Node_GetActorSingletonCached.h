@@ -0,0 +1,45 @@
+// Published under MIT License, created by https://github.com/sleeptightAnsiC
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node.h"
+#include "K2Node_GetActorSingletonCached.generated.h"
+
+/* "Get Actor Singleton (Cached)" Blueprint node
+* Unlike pure "Get Actor Singleton Instance", which resolves the UWorld, CDO and FinalParent for every pin it feeds,
+*	this one resolves the instance only once and keeps it in a hidden member variable of the Blueprint,
+*	until the registry changes (see AActorSingleton::GetInstanceCached).
+* Class must be picked on the node itself, so it's known (and validated) when the Blueprint compiles. */
+UCLASS()
+class ACTORSINGLETONUNCOOKED_API UK2Node_GetActorSingletonCached : public UK2Node
+{
+	GENERATED_BODY()
+
+public:
+
+	//~ Begin UEdGraphNode Interface
+	virtual void AllocateDefaultPins() override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual void PinDefaultValueChanged(UEdGraphPin* Pin) override;
+	virtual bool IsCompatibleWithGraph(const UEdGraph* TargetGraph) const override;
+	virtual void ValidateNodeDuringCompilation(FCompilerResultsLog& MessageLog) const override;
+	//~ End UEdGraphNode Interface
+
+	//~ Begin UK2Node Interface
+	virtual bool IsNodePure() const override { return true; }
+	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual FText GetMenuCategory() const override;
+	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	//~ End UK2Node Interface
+
+private:
+
+	UEdGraphPin* GetClassPin() const;
+	UEdGraphPin* GetResultPin() const;
+
+	/* Class picked on the Class pin, kept here so the Result pin has the right type right after reconstructing the node */
+	UPROPERTY()
+	TObjectPtr<UClass> SingletonClass;
+};